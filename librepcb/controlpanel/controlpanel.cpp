@@ -47,7 +47,8 @@ using namespace workspace;
  ****************************************************************************************/
 
 ControlPanel::ControlPanel(Workspace& workspace) :
-    QMainWindow(0), mWorkspace(workspace), mUi(new Ui::ControlPanel)
+    QMainWindow(0), mWorkspace(workspace), mUi(new Ui::ControlPanel),
+    mCancelRescanButton(nullptr)
 {
     mUi->setupUi(this);
 
@@ -66,6 +67,42 @@ ControlPanel::ControlPanel(Workspace& workspace) :
     connect(mUi->actionWorkspace_Settings, &QAction::triggered,
             &mWorkspace.getSettings(), &WorkspaceSettings::showSettingsDialog);
 
+    // show the state of library rescans (running in the background) in the status bar
+    library::Library& lib = mWorkspace.getLibrary();
+    mCancelRescanButton = new QToolButton(this);
+    mCancelRescanButton->setIcon(QIcon(":/img/actions/cancel.png"));
+    mCancelRescanButton->setToolTip(tr("Cancel library scan"));
+    mCancelRescanButton->setAutoRaise(true);
+    mCancelRescanButton->setVisible(false);
+    mUi->statusBar->addPermanentWidget(mCancelRescanButton);
+    connect(mCancelRescanButton, &QToolButton::clicked,
+            &lib, &library::Library::cancelRescan);
+    connect(&lib, &library::Library::rescanStarted, this, [this](){
+        mUi->actionRescanLibrary->setEnabled(false);
+        mCancelRescanButton->setVisible(true);
+        mUi->statusBar->showMessage(tr("Scanning library..."));
+    });
+    connect(&lib, &library::Library::rescanProgress, this, [this](int percent){
+        mUi->statusBar->showMessage(QString(tr("Scanning library... %1%")).arg(percent));
+    });
+    connect(&lib, &library::Library::rescanFinished, this, [this](int count){
+        mUi->actionRescanLibrary->setEnabled(true);
+        mCancelRescanButton->setVisible(false);
+        mUi->statusBar->showMessage(QString(tr("Successfully scanned %1 library elements."))
+                                    .arg(count), 5000);
+    });
+    connect(&lib, &library::Library::rescanCanceled, this, [this](){
+        mUi->actionRescanLibrary->setEnabled(true);
+        mCancelRescanButton->setVisible(false);
+        mUi->statusBar->showMessage(tr("Library scan canceled."), 5000);
+    });
+    connect(&lib, &library::Library::rescanFailed, this, [this](const QString& errorMsg){
+        mUi->actionRescanLibrary->setEnabled(true);
+        mCancelRescanButton->setVisible(false);
+        mUi->statusBar->clearMessage();
+        QMessageBox::critical(this, tr("Error"), errorMsg);
+    });
+
     mUi->projectTreeView->setModel(&mWorkspace.getProjectTreeModel());
     mUi->recentProjectsListView->setModel(&mWorkspace.getRecentProjectsModel());
     mUi->favoriteProjectsListView->setModel(&mWorkspace.getFavoriteProjectsModel());
@@ -540,19 +577,7 @@ void ControlPanel::on_favoriteProjectsListView_customContextMenuRequested(const
 
 void ControlPanel::on_actionRescanLibrary_triggered()
 {
-    try
-    {
-        QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-        int count = mWorkspace.getLibrary().rescan();
-        QApplication::restoreOverrideCursor();
-        QMessageBox::information(this, tr("Rescan Library"),
-            QString("Successfully scanned %1 library elements.").arg(count));
-    }
-    catch (Exception& e)
-    {
-        QApplication::restoreOverrideCursor();
-        QMessageBox::critical(this, tr("Error"), e.getUserMsg());
-    }
+    mWorkspace.getLibrary().startRescan(); // progress is shown in the status bar
 }
 
 /*****************************************************************************************
@@ -178,6 +178,7 @@ class ControlPanel final : public QMainWindow
         // Attributes
         workspace::Workspace& mWorkspace;
         Ui::ControlPanel* mUi;
+        QToolButton* mCancelRescanButton; ///< shown in the status bar while rescanning
         QHash<QString, project::ProjectEditor*> mOpenProjectEditors;
 };
 
@@ -0,0 +1,179 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "attributetexttemplate.h"
+#include "if_attributeprovider.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+AttributeTextTemplate::AttributeTextTemplate() noexcept :
+    mIsEvaluated(false), mHasNestedVariables(false)
+{
+}
+
+AttributeTextTemplate::AttributeTextTemplate(const AttributeTextTemplate& other) noexcept :
+    mRawText(other.mRawText), mTokens(other.mTokens), mVariables(other.mVariables),
+    mText(other.mText), mIsEvaluated(other.mIsEvaluated),
+    mHasNestedVariables(other.mHasNestedVariables)
+{
+}
+
+AttributeTextTemplate::AttributeTextTemplate(const QString& rawText) noexcept :
+    mRawText(rawText), mIsEvaluated(false), mHasNestedVariables(false)
+{
+    // split the text into literals and variables (the same way as
+    // IF_AttributeProvider::replaceVariablesWithAttributes() finds the variables)
+    int startPos = 0;
+    int pos = 0;
+    int length = 0;
+    Variable var;
+    while (IF_AttributeProvider::searchVariableInText(rawText, startPos, pos, length,
+                                                      var.ns, var.key))
+    {
+        var.complete = rawText.mid(pos, length);
+        int index = -1;
+        for (int i = 0; i < mVariables.count(); ++i) {
+            if (mVariables.at(i).complete == var.complete) {
+                index = i;
+                break;
+            }
+        }
+        if (index < 0) {
+            index = mVariables.count();
+            mVariables.append(var);
+        }
+        mTokens.append(Token{rawText.mid(startPos, pos - startPos), index});
+        startPos = pos + length;
+    }
+    mTokens.append(Token{rawText.mid(startPos), -1});
+}
+
+AttributeTextTemplate::~AttributeTextTemplate() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList AttributeTextTemplate::getDependencies() const noexcept
+{
+    QStringList dependencies;
+    foreach (const Variable& var, mVariables) {
+        dependencies.append(var.ns.isEmpty() ? var.key : (var.ns % "::" % var.key));
+    }
+    return dependencies;
+}
+
+bool AttributeTextTemplate::dependsOnAttribute(const QString& key) const noexcept
+{
+    if (!mIsEvaluated) return true;
+    if (mVariables.isEmpty()) return false;
+    if (key.isEmpty() || mHasNestedVariables) return true;
+    foreach (const Variable& var, mVariables) {
+        if (var.key == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool AttributeTextTemplate::update(const IF_AttributeProvider& provider, bool passToParents) noexcept
+{
+    // texts without variables need to be built only once
+    if (mIsEvaluated && mVariables.isEmpty()) return false;
+
+    bool modified = !mIsEvaluated;
+    mHasNestedVariables = false;
+    for (int i = 0; i < mVariables.count(); ++i) {
+        QString value = getValue(mVariables.at(i), provider, passToParents, mHasNestedVariables);
+        if (value != mVariables.at(i).value) {
+            mVariables[i].value = value;
+            modified = true;
+        }
+    }
+    if (!modified) return false;
+
+    mText.clear();
+    foreach (const Token& token, mTokens) {
+        mText.append(token.literal);
+        if (token.variableIndex >= 0) {
+            mText.append(mVariables.at(token.variableIndex).value);
+        }
+    }
+    mIsEvaluated = true;
+    return true;
+}
+
+/*****************************************************************************************
+ *  Operator Overloadings
+ ****************************************************************************************/
+
+AttributeTextTemplate& AttributeTextTemplate::operator=(const AttributeTextTemplate& rhs) noexcept
+{
+    mRawText = rhs.mRawText;
+    mTokens = rhs.mTokens;
+    mVariables = rhs.mVariables;
+    mText = rhs.mText;
+    mIsEvaluated = rhs.mIsEvaluated;
+    mHasNestedVariables = rhs.mHasNestedVariables;
+    return *this;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString AttributeTextTemplate::getValue(const Variable& var, const IF_AttributeProvider& provider,
+                                        bool passToParents, bool& hasNestedVariables) const noexcept
+{
+    QString value;
+    if (provider.getAttributeValue(var.ns, var.key, passToParents, value)) {
+        // avoid endless recursion
+        value.replace(var.complete, QCoreApplication::translate("IF_AttributeProvider",
+                                                               "[RECURSION REMOVED]"));
+        // values can contain variables too
+        if (value.contains("${")) {
+            hasNestedVariables = true; // depends on further (unknown) attributes
+            provider.replaceVariablesWithAttributes(value, passToParents);
+        }
+    }
+    return value;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_ATTRIBUTETEXTTEMPLATE_H
+#define LIBREPCB_ATTRIBUTETEXTTEMPLATE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class IF_AttributeProvider;
+
+/*****************************************************************************************
+ *  Class AttributeTextTemplate
+ ****************************************************************************************/
+
+/**
+ * @brief The AttributeTextTemplate class represents a precompiled text which can contain
+ *        variables (like "${NS::KEY}")
+ *
+ * IF_AttributeProvider#replaceVariablesWithAttributes() scans the whole text every time
+ * it is called. For texts which are displayed permanently (e.g. the texts of symbols and
+ * footprints), this class parses the raw text only once into a list of literal parts
+ * and variables. It also remembers the values of all variables (the dependencies of the
+ * text) of the last evaluation, so #update() is able to rebuild the text only if the
+ * value of at least one referenced attribute has changed. When the attribute provider
+ * reports which attribute has changed (IF_AttributeProvider#attributesChanged()),
+ * #dependsOnAttribute() tells whether the text needs to be updated at all.
+ *
+ * The resulting text is the same as with
+ * IF_AttributeProvider#replaceVariablesWithAttributes().
+ */
+class AttributeTextTemplate final
+{
+    public:
+
+        // Constructors / Destructor
+        AttributeTextTemplate() noexcept;
+        AttributeTextTemplate(const AttributeTextTemplate& other) noexcept;
+        explicit AttributeTextTemplate(const QString& rawText) noexcept;
+        ~AttributeTextTemplate() noexcept;
+
+        // Getters
+        const QString& getRawText() const noexcept {return mRawText;}
+        bool hasVariables() const noexcept {return !mVariables.isEmpty();}
+
+        /**
+         * @brief Get all variables the text depends on (e.g. "CMP::NAME")
+         *
+         * Variables without namespace are returned without the "::" (e.g. "NAME").
+         */
+        QStringList getDependencies() const noexcept;
+
+        /**
+         * @brief Get the text of the last #update() (all variables are replaced)
+         */
+        const QString& getText() const noexcept {return mText;}
+
+        /**
+         * @brief Check whether the text may depend on a specific attribute
+         *
+         * @param key   The attribute key without namespace (e.g. "NAME" for both
+         *              "${CMP::NAME}" and "${SYM::NAME}"), or an empty string if the
+         *              changed attribute is unknown
+         *
+         * @return False if the text certainly does not need an #update() after the
+         *         attribute has changed. Texts which were not evaluated yet and texts
+         *         with attribute values containing variables themselves always return
+         *         true (except for an empty key, which is true for all texts with
+         *         variables).
+         */
+        bool dependsOnAttribute(const QString& key) const noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Fetch the values of all referenced attributes and rebuild the text if
+         *        at least one of them has changed since the last call
+         *
+         * @param provider          The attribute provider to fetch the values from
+         * @param passToParents     See IF_AttributeProvider#replaceVariablesWithAttributes()
+         *
+         * @return True if the text (#getText()) was rebuilt, false if it is unchanged
+         */
+        bool update(const IF_AttributeProvider& provider, bool passToParents) noexcept;
+
+        // Operator Overloadings
+        AttributeTextTemplate& operator=(const AttributeTextTemplate& rhs) noexcept;
+
+
+    private:
+
+        // Private Types
+        struct Variable {
+            QString ns;         ///< the namespace, e.g. "CMP" in "${CMP::NAME}"
+            QString key;        ///< the attribute key, e.g. "NAME" in "${CMP::NAME}"
+            QString complete;   ///< the whole variable, e.g. "${CMP::NAME}"
+            QString value;      ///< the value at the last #update()
+        };
+        struct Token {
+            QString literal;    ///< the literal text in front of the variable
+            int variableIndex;  ///< index in #mVariables, or -1 for the trailing literal
+        };
+
+
+        // Private Methods
+        QString getValue(const Variable& var, const IF_AttributeProvider& provider,
+                         bool passToParents, bool& hasNestedVariables) const noexcept;
+
+
+        // Attributes
+        QString mRawText;
+        QList<Token> mTokens;
+        QList<Variable> mVariables; ///< each variable only once (in order of occurrence)
+        QString mText;
+        bool mIsEvaluated;          ///< whether #update() was called at least once
+        bool mHasNestedVariables;   ///< whether an attribute value contained variables
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_ATTRIBUTETEXTTEMPLATE_H
@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BATCHEDCHANGES_H
+#define LIBREPCB_BATCHEDCHANGES_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class BatchedChanges
+ ****************************************************************************************/
+
+/**
+ * @brief The BatchedChanges class collects the modifications of a list during a batch
+ *
+ * The owner of the list reports every modification, and at the end of the batch it
+ * fetches the net result with #takeAll(). Modifications which cancel each other out are
+ * merged: an item which is added and removed again within the same batch is not
+ * reported at all, and an item which is removed and added again is reported as changed.
+ *
+ * @note The items are only compared, never dereferenced. Removed items may therefore
+ *       already be deleted when they are reported.
+ *
+ * @tparam T    The item type (must be usable as key of a QHash, e.g. a pointer)
+ */
+template <typename T>
+class BatchedChanges final
+{
+    public:
+
+        // Constructors / Destructor
+        BatchedChanges() noexcept {}
+        BatchedChanges(const BatchedChanges& other) = default;
+        ~BatchedChanges() noexcept {}
+
+        // Getters
+
+        /// Check whether there are no changes to report
+        bool isEmpty() const noexcept
+        {
+            return mAdded.isEmpty() && mRemoved.isEmpty() && mChanged.isEmpty();
+        }
+
+        // General Methods
+
+        /// An item was added to the list
+        void add(const T& item) noexcept
+        {
+            if (mRemoved.remove(item)) {
+                mChanged.insert(item); // it was already in the list before the batch
+            } else {
+                mAdded.insert(item);
+            }
+        }
+
+        /// An item was removed from the list
+        void remove(const T& item) noexcept
+        {
+            mChanged.remove(item);
+            if (!mAdded.remove(item)) {
+                mRemoved.insert(item); // it was already in the list before the batch
+            }
+        }
+
+        /// An item in the list was modified
+        void update(const T& item) noexcept
+        {
+            if (!mAdded.contains(item)) {
+                mChanged.insert(item);
+            }
+        }
+
+        /// Get all collected changes and reset them
+        void takeAll(QList<T>& added, QList<T>& removed, QList<T>& changed) noexcept
+        {
+            added = mAdded.toList();
+            removed = mRemoved.toList();
+            changed = mChanged.toList();
+            clear();
+        }
+
+        /// Discard all collected changes
+        void clear() noexcept {mAdded.clear(); mRemoved.clear(); mChanged.clear();}
+
+        // Operator Overloadings
+        BatchedChanges& operator=(const BatchedChanges& rhs) = default;
+
+
+    private:
+
+        // Attributes
+        QSet<T> mAdded;
+        QSet<T> mRemoved;
+        QSet<T> mChanged;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_BATCHEDCHANGES_H
@@ -54,6 +54,7 @@ void ExcellonGenerator::drill(const Point& pos, const Length& dia) noexcept
 void ExcellonGenerator::generate() throw (Exception)
 {
     mOutput.clear();
+    mOutput.reserve(mDrillList.count() * 24 + 1024); // ~24 characters per drill
     printHeader();
     printDrills();
     printFooter();
@@ -62,7 +63,7 @@ void ExcellonGenerator::generate() throw (Exception)
 void ExcellonGenerator::saveToFile(const FilePath& filepath) const throw (Exception)
 {
     QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
-    file->setContent(mOutput.toLatin1());
+    file->setContent(mOutput); // implicitly shared, no copy
     file->save(true);
 }
 
@@ -82,8 +83,8 @@ void ExcellonGenerator::printHeader() noexcept
 
     // Comments
     mOutput.append(";DRILL FILE\n");
-    mOutput.append(QString(";Generated by LibrePCB %1\n").arg(qApp->applicationVersion()));
-    mOutput.append(QString(";Creation Date: %1\n").arg(QDateTime::currentDateTime().toString(Qt::ISODate)));
+    mOutput.append(QString(";Generated by LibrePCB %1\n").arg(qApp->applicationVersion()).toLatin1());
+    mOutput.append(QString(";Creation Date: %1\n").arg(QDateTime::currentDateTime().toString(Qt::ISODate)).toLatin1());
     mOutput.append("FMAT,2\n");     // Use Format 2 commands
     mOutput.append("METRIC,TZ\n");  // Metric Format, Trailing Zeros Mode
 
@@ -97,21 +98,33 @@ void ExcellonGenerator::printHeader() noexcept
 
 void ExcellonGenerator::printToolList() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        Length dia = mDrillList.uniqueKeys().value(i);
-        mOutput.append(QString("T%1C%2\n").arg(i+1).arg(dia.toMmString()));
+    QList<Length> diameters = mDrillList.uniqueKeys();
+    for (int i = 0; i < diameters.count(); ++i) {
+        mOutput.append('T');
+        mOutput.append(QByteArray::number(i+1));
+        mOutput.append('C');
+        appendMm(mOutput, diameters.at(i));
+        mOutput.append('\n');
     }
 }
 
 void ExcellonGenerator::printDrills() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        mOutput.append(QString("T%1\n").arg(i+1)); // Select Tool
-        Length dia = mDrillList.uniqueKeys().value(i);
-        foreach (const Point& pos, mDrillList.values(dia)) {
-            mOutput.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
-                                                   pos.getY().toMmString()));
+    // the drill list is sorted by diameter, so a single pass over it is sufficient
+    int tool = 0;
+    Length currentDia;
+    for (auto it = mDrillList.constBegin(); it != mDrillList.constEnd(); ++it) {
+        if ((tool == 0) || (it.key() != currentDia)) {
+            currentDia = it.key();
+            mOutput.append('T');
+            mOutput.append(QByteArray::number(++tool)); // Select Tool
+            mOutput.append('\n');
         }
+        mOutput.append('X');
+        appendMm(mOutput, it.value().getX());
+        mOutput.append('Y');
+        appendMm(mOutput, it.value().getY());
+        mOutput.append('\n');
     }
 }
 
@@ -121,6 +134,29 @@ void ExcellonGenerator::printFooter() noexcept
     mOutput.append("M30\n");        // End of Program Rewind
 }
 
+void ExcellonGenerator::appendMm(QByteArray& output, const Length& length) noexcept
+{
+    // same output as Length::toMmString(), but without any temporary strings
+    qint64 nm = length.toNm();
+    quint64 absValue = (nm < 0) ? (~quint64(nm) + 1) : quint64(nm);
+    quint64 integer = absValue / 1000000;
+    quint64 fraction = absValue % 1000000;
+    char buffer[32];
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+    for (int i = 0; i < 6; ++i) {
+        *--begin = char('0' + (fraction % 10));
+        fraction /= 10;
+    }
+    *--begin = '.';
+    do {
+        *--begin = char('0' + (integer % 10));
+        integer /= 10;
+    } while (integer > 0);
+    if (nm < 0) *--begin = '-';
+    output.append(begin, end - begin);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
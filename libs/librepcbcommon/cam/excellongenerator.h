@@ -56,7 +56,8 @@ class ExcellonGenerator final
         ~ExcellonGenerator() noexcept;
 
         // Getters
-        const QString& toStr() const noexcept {return mOutput;}
+        QString toStr() const noexcept {return QString::fromLatin1(mOutput);}
+        const QByteArray& toByteArray() const noexcept {return mOutput;}
 
         // General Methods
         void drill(const Point& pos, const Length& dia) noexcept;
@@ -74,10 +75,11 @@ class ExcellonGenerator final
         void printToolList() noexcept;
         void printDrills() noexcept;
         void printFooter() noexcept;
+        static void appendMm(QByteArray& output, const Length& length) noexcept;
 
 
         // Excellon Data
-        QString mOutput;
+        QByteArray mOutput;
         QMultiMap<Length, Point> mDrillList;
 };
 
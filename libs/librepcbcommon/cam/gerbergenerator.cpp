@@ -200,6 +200,7 @@ void GerberGenerator::reset() noexcept
 void GerberGenerator::generate() throw (Exception)
 {
     mOutput.clear();
+    mOutput.reserve(mContent.size() + 4096); // the content is by far the largest part
     printHeader();
     printApertureList();
     printContent();
@@ -209,7 +210,7 @@ void GerberGenerator::generate() throw (Exception)
 void GerberGenerator::saveToFile(const FilePath& filepath) const throw (Exception)
 {
     QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
-    file->setContent(mOutput.toLatin1());
+    file->setContent(mOutput); // implicitly shared, no copy
     file->save(true);
 }
 
@@ -220,7 +221,9 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const throw (Exceptio
 void GerberGenerator::setCurrentAperture(int number) noexcept
 {
     if (number != mCurrentApertureNumber) {
-        mContent.append(QString("D%1*\n").arg(number));
+        mContent.append('D');
+        appendInteger(mContent, number);
+        mContent.append("*\n");
         mCurrentApertureNumber = number;
     }
 }
@@ -268,14 +271,20 @@ void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D02*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    mContent.append('X');
+    appendInteger(mContent, pos.getX().toNm());
+    mContent.append('Y');
+    appendInteger(mContent, pos.getY().toNm());
+    mContent.append("D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D01*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    mContent.append('X');
+    appendInteger(mContent, pos.getX().toNm());
+    mContent.append('Y');
+    appendInteger(mContent, pos.getY().toNm());
+    mContent.append("D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start, const Point& center, const Point& end) noexcept
@@ -284,16 +293,24 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start, const Po
     if (!mMultiQuadrantArcModeOn) {
         diff.makeAbs(); // no sign allowed in single quadrant mode!
     }
-    mContent.append(QString("X%1Y%2I%3J%4D01*\n").arg(end.getX().toNmString(),
-                                                      end.getY().toNmString(),
-                                                      diff.getX().toNmString(),
-                                                      diff.getY().toNmString()));
+    mContent.append('X');
+    appendInteger(mContent, end.getX().toNm());
+    mContent.append('Y');
+    appendInteger(mContent, end.getY().toNm());
+    mContent.append('I');
+    appendInteger(mContent, diff.getX().toNm());
+    mContent.append('J');
+    appendInteger(mContent, diff.getY().toNm());
+    mContent.append("D01*\n");
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D03*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    mContent.append('X');
+    appendInteger(mContent, pos.getX().toNm());
+    mContent.append('Y');
+    appendInteger(mContent, pos.getY().toNm());
+    mContent.append("D03*\n");
 }
 
 void GerberGenerator::printHeader() noexcept
@@ -301,9 +318,9 @@ void GerberGenerator::printHeader() noexcept
     mOutput.append("G04 --- HEADER BEGIN --- *\n");
 
     // add some X2 attributes
-    mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(qApp->applicationVersion()));
-    mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(QDateTime::currentDateTime().toString(Qt::ISODate)));
-    mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(mProjectId, mProjectGuid, mProjectRevision));
+    mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(qApp->applicationVersion()).toLatin1());
+    mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(QDateTime::currentDateTime().toString(Qt::ISODate)).toLatin1());
+    mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(mProjectId, mProjectGuid, mProjectRevision).toLatin1());
     mOutput.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
     //mOutput.append("%TF.FilePolarity,Positive*%\n");
 
@@ -327,7 +344,7 @@ void GerberGenerator::printHeader() noexcept
 
 void GerberGenerator::printApertureList() noexcept
 {
-    mOutput.append(mApertureList->generateString());
+    mOutput.append(mApertureList->generateString().toLatin1());
 }
 
 void GerberGenerator::printContent() noexcept
@@ -340,17 +357,48 @@ void GerberGenerator::printContent() noexcept
 void GerberGenerator::printFooter() noexcept
 {
     // MD5 checksum over content
-    mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+    QByteArray md5 = calcOutputMd5Checksum();
+    mOutput.append("%TF.MD5,");
+    mOutput.append(md5);
+    mOutput.append("*%\n");
 
     // end of file
     mOutput.append("M02*\n");
 }
 
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept
+QByteArray GerberGenerator::calcOutputMd5Checksum() const noexcept
 {
-    // according to the RS-274C standard, linebreaks are not included in the checksum
-    QString data = QString(mOutput).remove(QChar('\n'));
-    return QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+    // according to the RS-274C standard, linebreaks are not included in the checksum, so
+    // the hash is fed line by line directly from the output buffer (without any copy)
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    const char* begin = mOutput.constData();
+    const char* end = begin + mOutput.size();
+    while (begin < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(begin, '\n', end - begin));
+        if (!lineEnd) lineEnd = end;
+        hash.addData(begin, lineEnd - begin);
+        begin = lineEnd + 1;
+    }
+    return hash.result().toHex();
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void GerberGenerator::appendInteger(QByteArray& output, qint64 value) noexcept
+{
+    // fast path for QByteArray::number() which doesn't need a temporary byte array
+    char buffer[24];
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+    quint64 absValue = (value < 0) ? (~quint64(value) + 1) : quint64(value);
+    do {
+        *--begin = char('0' + (absValue % 10));
+        absValue /= 10;
+    } while (absValue > 0);
+    if (value < 0) *--begin = '-';
+    output.append(begin, end - begin);
 }
 
 /*****************************************************************************************
@@ -70,7 +70,8 @@ class GerberGenerator final
         ~GerberGenerator() noexcept;
 
         // Getters
-        const QString& toStr() const noexcept {return mOutput;}
+        QString toStr() const noexcept {return QString::fromLatin1(mOutput);}
+        const QByteArray& toByteArray() const noexcept {return mOutput;}
 
         // Plot Methods
         void setLayerPolarity(LayerPolarity p) noexcept;
@@ -112,7 +113,10 @@ class GerberGenerator final
         void printApertureList() noexcept;
         void printContent() noexcept;
         void printFooter() noexcept;
-        QString calcOutputMd5Checksum() const noexcept;
+        QByteArray calcOutputMd5Checksum() const noexcept;
+
+        // Static Methods
+        static void appendInteger(QByteArray& output, qint64 value) noexcept;
 
 
         // Metadata
@@ -120,9 +124,9 @@ class GerberGenerator final
         QString mProjectGuid;
         QString mProjectRevision;
 
-        // Gerber Data
-        QString mOutput;
-        QString mContent;
+        // Gerber Data (always Latin-1/ASCII, exactly as written to the file)
+        QByteArray mOutput;
+        QByteArray mContent;
         QScopedPointer<GerberApertureList> mApertureList;
         int mCurrentApertureNumber;
         bool mMultiQuadrantArcModeOn;
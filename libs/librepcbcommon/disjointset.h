@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_DISJOINTSET_H
+#define LIBREPCB_DISJOINTSET_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class DisjointSet
+ ****************************************************************************************/
+
+/**
+ * @brief The DisjointSet class implements a union-find data structure
+ *
+ * Each element belongs to exactly one set, identified by its representative (root)
+ * element. Uniting two sets and looking up the representative of an element are both
+ * nearly constant in time (union by rank, path compression).
+ *
+ * Removing single elements is not supported by this data structure. Owners which need
+ * to remove elements have to #clear() the set and add the remaining elements again.
+ *
+ * @tparam T    The element type (must be usable as key of a QHash, e.g. a pointer)
+ */
+template <typename T>
+class DisjointSet final
+{
+    public:
+
+        // Constructors / Destructor
+        DisjointSet() noexcept : mSetCount(0) {}
+        DisjointSet(const DisjointSet& other) = default;
+        ~DisjointSet() noexcept {}
+
+        // Getters
+
+        /// Get the count of elements
+        int getElementCount() const noexcept {return mNodes.count();}
+
+        /// Get the count of disjoint sets
+        int getSetCount() const noexcept {return mSetCount;}
+
+        /// Check whether an element was added
+        bool contains(const T& element) const noexcept {return mNodes.contains(element);}
+
+        /**
+         * @brief Get the representative element of the set which contains an element
+         *
+         * @param element   The element (gets added as a new set if it does not exist yet)
+         *
+         * @return The representative element (equal for all elements of the same set)
+         */
+        T find(const T& element) noexcept
+        {
+            auto it = mNodes.find(element);
+            if (it == mNodes.end()) {
+                it = mNodes.insert(element, Node_t{element, 0});
+                mSetCount++;
+            }
+            if (it.value().parent == element) return element;
+            T root = find(it.value().parent);
+            mNodes[element].parent = root; // path compression
+            return root;
+        }
+
+        // General Methods
+
+        /// Add an element as a new set (nothing happens if it exists already)
+        void add(const T& element) noexcept {find(element);}
+
+        /**
+         * @brief Unite the sets of two elements (non-existing elements get added)
+         *
+         * @retval true     If the two elements were in different sets before
+         * @retval false    If the two elements were already in the same set
+         */
+        bool unite(const T& a, const T& b) noexcept
+        {
+            T rootA = find(a);
+            T rootB = find(b);
+            if (rootA == rootB) return false;
+            Node_t& nodeA = mNodes[rootA];
+            Node_t& nodeB = mNodes[rootB];
+            if (nodeA.rank < nodeB.rank) {
+                nodeA.parent = rootB;
+            } else if (nodeA.rank > nodeB.rank) {
+                nodeB.parent = rootA;
+            } else {
+                nodeB.parent = rootA;
+                nodeA.rank++;
+            }
+            mSetCount--;
+            return true;
+        }
+
+        /// Check whether two elements are in the same set (non-existing elements get added)
+        bool areInSameSet(const T& a, const T& b) noexcept {return find(a) == find(b);}
+
+        /// Remove all elements
+        void clear() noexcept {mNodes.clear(); mSetCount = 0;}
+
+        // Operator Overloadings
+        DisjointSet& operator=(const DisjointSet& rhs) = default;
+
+
+    private:
+
+        // Types
+        struct Node_t {
+            T parent;
+            int rank;
+        };
+
+        // Attributes
+        QHash<T, Node_t> mNodes;
+        int mSetCount;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_DISJOINTSET_H
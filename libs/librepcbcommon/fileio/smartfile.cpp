@@ -35,7 +35,7 @@ namespace librepcb {
 SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool create) throw (Exception) :
     mFilePath(filepath), mTmpFilePath(filepath.toStr() % '~'),
     mOpenedFilePath(filepath), mIsRestored(restore), mIsReadOnly(readOnly),
-    mIsCreated(create)
+    mIsCreated(create), mOriginalRevision(0), mBackupRevision(0)
 {
     if (create)
     {
@@ -66,6 +66,12 @@ SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool
         if ((mIsRestored) && (mTmpFilePath.isExistingFile()))
             mOpenedFilePath = mTmpFilePath;
 
+        // the opened file contains the first revision of the content
+        if (mOpenedFilePath == mTmpFilePath)
+            mBackupRevision = 1;
+        else
+            mOriginalRevision = 1;
+
         // check if the file exists
         if (!mOpenedFilePath.isExistingFile())
         {
@@ -103,6 +109,31 @@ void SmartFile::removeFile(bool original) throw (Exception)
                 QString(tr("Cannot remove file \"%1\"")).arg(filepath.toNative()));
         }
     }
+
+    if (original)
+        mOriginalRevision = 0;
+    else
+        mBackupRevision = 0;
+}
+
+bool SmartFile::tryUpdateToRevision(quint64 revision, bool toOriginal) throw (Exception)
+{
+    if ((mIsReadOnly) || (revision == 0))
+        return false; // let the subclass report errors while saving
+
+    if (revision == (toOriginal ? mOriginalRevision : mBackupRevision))
+        return true; // nothing to do
+
+    if ((toOriginal) && (revision == mBackupRevision))
+    {
+        // promote the backup file to the original file
+        const FilePath& filepath = prepareSaveAndReturnFilePath(true);
+        saveContentToFile(filepath, readContentFromFile(mTmpFilePath));
+        updateMembersAfterSaving(true, revision);
+        return true;
+    }
+
+    return false;
 }
 
 /*****************************************************************************************
@@ -126,8 +157,13 @@ const FilePath& SmartFile::prepareSaveAndReturnFilePath(bool toOriginal) throw (
     return filepath;
 }
 
-void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
+void SmartFile::updateMembersAfterSaving(bool toOriginal, quint64 revision) noexcept
 {
+    if (toOriginal)
+        mOriginalRevision = revision;
+    else
+        mBackupRevision = revision;
+
     if (toOriginal && mIsRestored)
         mIsRestored = false;
 
@@ -46,6 +46,7 @@ namespace librepcb {
  *  - Creation of backup files ('~' at the end of the filename)
  *  - Restoring backup files
  *  - Helper methods for subclasses to load/save files
+ *  - Tracking of the content revisions stored in the files to avoid needless writes
  *
  * @note See @ref doc_project_save for more details about the backup/restore feature.
  *
@@ -135,6 +136,26 @@ class SmartFile
          */
         void removeFile(bool original) throw (Exception);
 
+        /**
+         * @brief Try to bring the file up to date with a content revision without writing it
+         *
+         * Revisions are counted by the owner of the file and are passed to the save
+         * methods of the subclasses. The content loaded in the constructor has the
+         * revision 1, the revision 0 means "unknown". If the requested file already
+         * contains the revision, nothing needs to be done. If the original file is
+         * requested and the backup file contains the revision, the backup file is copied
+         * to the original file instead of serializing the content again.
+         *
+         * @param revision      The revision of the content which should be saved
+         * @param toOriginal    Specifies whether the original or the backup file is requested
+         *
+         * @retval true     The file is up to date, the content does not need to be saved
+         * @retval false    The content must be saved (together with its revision)
+         *
+         * @throw Exception If the backup file could not be copied to the original file
+         */
+        bool tryUpdateToRevision(quint64 revision, bool toOriginal) throw (Exception);
+
 
     private:
 
@@ -175,8 +196,9 @@ class SmartFile
          *       to the file!
          *
          * @param toOriginal    Specifies whether the original or the backup file was saved.
+         * @param revision      The content revision which was saved (0 = unknown)
          */
-        void updateMembersAfterSaving(bool toOriginal) noexcept;
+        void updateMembersAfterSaving(bool toOriginal, quint64 revision = 0) noexcept;
 
         /**
          * @brief Helper method to read the content from a file into a QByteArray
@@ -247,6 +269,20 @@ class SmartFile
          */
         bool mIsCreated;
 
+        /**
+         * @brief The content revision stored in the original file (0 = unknown)
+         *
+         * @see #tryUpdateToRevision()
+         */
+        quint64 mOriginalRevision;
+
+        /**
+         * @brief The content revision stored in the backup file (0 = unknown)
+         *
+         * @see #tryUpdateToRevision()
+         */
+        quint64 mBackupRevision;
+
 };
 
 /*****************************************************************************************
@@ -24,6 +24,7 @@
 #include "smartxmlfile.h"
 #include "xmldomdocument.h"
 #include "xmldomelement.h"
+#include "smartxmlfilewriter.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -68,7 +69,8 @@ QSharedPointer<XmlDomDocument> SmartXmlFile::parseFileAndBuildDomTree(bool check
     return doc;
 }
 
-void SmartXmlFile::save(const XmlDomDocument& domDocument, bool toOriginal) throw (Exception)
+void SmartXmlFile::save(const XmlDomDocument& domDocument, bool toOriginal,
+                        quint64 revision) throw (Exception)
 {
     // check if file version <= application's major version (if available)
     Q_ASSERT((!domDocument.hasFileVersion()) || (domDocument.getFileVersion() >= 0));
@@ -76,7 +78,17 @@ void SmartXmlFile::save(const XmlDomDocument& domDocument, bool toOriginal) thro
 
     const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
     saveContentToFile(filepath, domDocument.toByteArray());
-    updateMembersAfterSaving(toOriginal);
+    updateMembersAfterSaving(toOriginal, revision);
+}
+
+void SmartXmlFile::save(const QSharedPointer<XmlDomDocument>& domDocument, bool toOriginal,
+                        quint64 revision, SmartXmlFileWriter* writer) throw (Exception)
+{
+    Q_ASSERT(domDocument);
+    if (writer)
+        writer->enqueue(*this, domDocument, toOriginal, revision);
+    else
+        save(*domDocument, toOriginal, revision);
 }
 
 /*****************************************************************************************
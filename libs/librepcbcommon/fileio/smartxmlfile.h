@@ -32,6 +32,7 @@
 namespace librepcb {
 
 class XmlDomDocument;
+class SmartXmlFileWriter;
 
 /*****************************************************************************************
  *  Class SmartXmlFile
@@ -99,10 +100,28 @@ class SmartXmlFile final : public SmartFile
          * @param domDocument   The DOM document to save
          * @param toOriginal    Specifies whether the original or the backup file should
          *                      be overwritten/created.
+         * @param revision      The content revision of the DOM document (0 = unknown),
+         *                      see SmartFile#tryUpdateToRevision()
          *
          * @throw Exception If an error occurs
          */
-        void save(const XmlDomDocument& domDocument, bool toOriginal) throw (Exception);
+        void save(const XmlDomDocument& domDocument, bool toOriginal,
+                  quint64 revision = 0) throw (Exception);
+
+        /**
+         * @brief Write the XML DOM tree to the file system, optionally in a worker thread
+         *
+         * @param domDocument   The DOM document to save
+         * @param toOriginal    See #save()
+         * @param revision      See #save()
+         * @param writer        If not nullptr, the document is only queued to this writer
+         *                      and written as soon as the writer is started. Otherwise
+         *                      the document is written immediately.
+         *
+         * @throw Exception If an error occurs
+         */
+        void save(const QSharedPointer<XmlDomDocument>& domDocument, bool toOriginal,
+                  quint64 revision, SmartXmlFileWriter* writer) throw (Exception);
 
 
         // Static Methods
@@ -125,6 +144,8 @@ class SmartXmlFile final : public SmartFile
 
     private:
 
+        friend class SmartXmlFileWriter; // needs access to the protected save methods
+
         // make some methods inaccessible...
         SmartXmlFile();
         SmartXmlFile(const SmartXmlFile& other);
@@ -0,0 +1,144 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent>
+#include "smartxmlfilewriter.h"
+#include "smartxmlfile.h"
+#include "xmldomdocument.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SmartXmlFileWriter::SmartXmlFileWriter(QObject* parent) noexcept :
+    QObject(parent)
+{
+    connect(&mWatcher, &QFutureWatcher<void>::finished,
+            this, &SmartXmlFileWriter::watcherFinished);
+}
+
+SmartXmlFileWriter::~SmartXmlFileWriter() noexcept
+{
+    mWatcher.waitForFinished(); // the worker thread accesses our members
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void SmartXmlFileWriter::enqueue(SmartXmlFile& file,
+                                 const QSharedPointer<XmlDomDocument>& domDocument,
+                                 bool toOriginal, quint64 revision) throw (Exception)
+{
+    // check if file version <= application's major version (if available)
+    Q_ASSERT((!domDocument->hasFileVersion()) || (domDocument->getFileVersion() >= 0));
+    Q_ASSERT((!domDocument->hasFileVersion()) || (domDocument->getFileVersion() <= APP_VERSION_MAJOR));
+
+    // throws if the file is read-only, and creates the parent directories
+    FilePath filepath = file.prepareSaveAndReturnFilePath(toOriginal);
+    mQueuedJobs.append(Job{&file, filepath, domDocument, toOriginal, revision, QString()});
+}
+
+void SmartXmlFileWriter::start() noexcept
+{
+    if (isRunning() || mQueuedJobs.isEmpty()) return;
+    watcherFinished(); // collect the results of the last run if not yet done
+    Q_ASSERT(mRunningJobs.isEmpty());
+
+    mRunningJobs = mQueuedJobs;
+    mQueuedJobs.clear();
+    mWatcher.setFuture(QtConcurrent::run(&SmartXmlFileWriter::writeJobs, &mRunningJobs));
+    emit started();
+}
+
+bool SmartXmlFileWriter::waitForFinished(QStringList& errors) noexcept
+{
+    mWatcher.waitForFinished();
+    if (mRunningJobs.isEmpty()) return true; // nothing was running
+
+    QStringList newErrors;
+    bool success = collectResults(newErrors);
+    errors.append(newErrors);
+    emit finished(success, newErrors);
+    return success;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void SmartXmlFileWriter::writeJobs(QList<Job>* jobs) noexcept
+{
+    for (int i = 0; i < jobs->count(); ++i)
+    {
+        Job& job = (*jobs)[i];
+        try
+        {
+            SmartXmlFile::saveContentToFile(job.filepath, job.document->toByteArray());
+        }
+        catch (const Exception& e)
+        {
+            job.error = e.getUserMsg();
+        }
+    }
+}
+
+bool SmartXmlFileWriter::collectResults(QStringList& errors) noexcept
+{
+    bool success = true;
+    foreach (const Job& job, mRunningJobs)
+    {
+        if (job.error.isEmpty())
+        {
+            job.file->updateMembersAfterSaving(job.toOriginal, job.revision);
+        }
+        else
+        {
+            success = false;
+            errors.append(job.error);
+        }
+    }
+    mRunningJobs.clear(); // also releases the DOM documents
+    return success;
+}
+
+void SmartXmlFileWriter::watcherFinished() noexcept
+{
+    // the results may already be collected by waitForFinished() or start()
+    if (isRunning() || mRunningJobs.isEmpty()) return;
+
+    QStringList errors;
+    bool success = collectResults(errors);
+    emit finished(success, errors);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SMARTXMLFILEWRITER_H
+#define LIBREPCB_SMARTXMLFILEWRITER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../exceptions.h"
+#include "filepath.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class SmartXmlFile;
+class XmlDomDocument;
+
+/*****************************************************************************************
+ *  Class SmartXmlFileWriter
+ ****************************************************************************************/
+
+/**
+ * @brief The SmartXmlFileWriter class writes XML DOM documents of #SmartXmlFile objects
+ *        in a worker thread
+ *
+ * The DOM documents are created in the calling thread (this is cheap) and queued with
+ * #enqueue() (or SmartXmlFile#save() with a writer). After calling #start(), converting
+ * the documents to XML and writing them to the files is done in a worker thread. The
+ * saved revisions of the files (see SmartFile#tryUpdateToRevision()) are updated in the
+ * thread of this object after all files were written, then #finished() is emitted.
+ *
+ * @warning The #SmartXmlFile objects must not be saved by other means and must not be
+ *          destroyed while this writer is running. Use #waitForFinished() before.
+ */
+class SmartXmlFileWriter final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        SmartXmlFileWriter(const SmartXmlFileWriter& other) = delete;
+        SmartXmlFileWriter& operator=(const SmartXmlFileWriter& rhs) = delete;
+        explicit SmartXmlFileWriter(QObject* parent = nullptr) noexcept;
+        ~SmartXmlFileWriter() noexcept;
+
+        // Getters
+        bool isRunning() const noexcept {return mWatcher.isRunning();}
+
+        // General Methods
+
+        /**
+         * @brief Queue a DOM document to be written by the next #start()
+         *
+         * @throw Exception If the file cannot be saved (e.g. opened in read-only mode)
+         */
+        void enqueue(SmartXmlFile& file, const QSharedPointer<XmlDomDocument>& domDocument,
+                     bool toOriginal, quint64 revision) throw (Exception);
+
+        /**
+         * @brief Start writing all queued documents in a worker thread
+         *
+         * Does nothing if the writer is already running or nothing was queued.
+         */
+        void start() noexcept;
+
+        /**
+         * @brief Block until all started documents are written
+         *
+         * @param errors    The error messages of the failed files will be appended here
+         *
+         * @return true if all files were written successfully, false otherwise
+         */
+        bool waitForFinished(QStringList& errors) noexcept;
+
+
+    signals:
+
+        void started();
+        void finished(bool success, const QStringList& errors);
+
+
+    private:
+
+        // Private Types
+        struct Job {
+            SmartXmlFile* file;
+            FilePath filepath;          ///< the original or the backup file to write
+            QSharedPointer<XmlDomDocument> document;
+            bool toOriginal;
+            quint64 revision;
+            QString error;              ///< empty if written successfully
+        };
+
+        // Private Methods
+        static void writeJobs(QList<Job>* jobs) noexcept;
+        bool collectResults(QStringList& errors) noexcept;
+        void watcherFinished() noexcept;
+
+        // Attributes
+        QList<Job> mQueuedJobs;     ///< the jobs for the next #start()
+        QList<Job> mRunningJobs;    ///< only accessed by the worker thread while running
+        QFutureWatcher<void> mWatcher;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SMARTXMLFILEWRITER_H
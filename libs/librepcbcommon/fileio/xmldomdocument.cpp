@@ -34,23 +34,30 @@ namespace librepcb {
  ****************************************************************************************/
 
 XmlDomDocument::XmlDomDocument(XmlDomElement& root) noexcept :
-    mFilePath(), mRootElement(&root)
+    mFilePath(), mRootElement(&root), mSizeHint(0)
 {
     mRootElement->setDocument(this);
 }
 
 XmlDomDocument::XmlDomDocument(const QByteArray& xmlFileContent, const FilePath& filepath) throw (Exception) :
-    mFilePath(filepath), mRootElement(nullptr)
+    mFilePath(filepath), mRootElement(nullptr), mSizeHint(xmlFileContent.size())
 {
-    QDomDocument doc;
-    doc.implementation().setInvalidDataPolicy(QDomImplementation::ReturnNullNode);
+    // build our own DOM tree directly from the XML stream (single pass, no QDomDocument)
+    QXmlStreamReader reader(xmlFileContent);
+    if (reader.readNextStartElement())
+        mRootElement = XmlDomElement::fromXmlStreamReader(reader, this);
 
-    QString errMsg;
-    int errLine;
-    int errColumn;
-    if (!doc.setContent(xmlFileContent, &errMsg, &errLine, &errColumn))
+    // read the rest of the document to detect errors after the root element
+    while ((!reader.atEnd()) && (!reader.hasError()))
+        reader.readNext();
+
+    if (reader.hasError())
     {
-        QString line = xmlFileContent.split('\n').at(errLine-1);
+        delete mRootElement;    mRootElement = nullptr;
+        QString errMsg = reader.errorString();
+        int errLine = reader.lineNumber();
+        int errColumn = reader.columnNumber();
+        QString line = xmlFileContent.split('\n').value(errLine-1);
         throw RuntimeError(__FILE__, __LINE__, QString("%1: %2 [%3:%4] LINE:%5")
             .arg(filepath.toStr(), errMsg).arg(errLine).arg(errColumn).arg(line),
             QString(tr("Error while parsing XML in file \"%1\": %2 [%3:%4]"))
@@ -58,14 +65,11 @@ XmlDomDocument::XmlDomDocument(const QByteArray& xmlFileContent, const FilePath&
     }
 
     // check if the root node exists
-    QDomElement root = doc.documentElement();
-    if (root.isNull())
+    if (!mRootElement)
     {
         throw RuntimeError(__FILE__, __LINE__, QString(),
-            QString(tr("No XML root node found in \"%1\"!")).arg(/*xmlFilePath.toNative()*/QString()));
+            QString(tr("No XML root node found in \"%1\"!")).arg(filepath.toNative()));
     }
-
-    mRootElement = XmlDomElement::fromQDomElement(root, this);
 }
 
 XmlDomDocument::~XmlDomDocument() noexcept
@@ -107,11 +111,12 @@ void XmlDomDocument::setFileVersion(int version) noexcept
 
 QByteArray XmlDomDocument::toByteArray() const noexcept
 {
-    QDomDocument doc;
-    doc.implementation().setInvalidDataPolicy(QDomImplementation::ReturnNullNode);
-    doc.setContent(QString("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>"));
-    doc.appendChild(mRootElement->toQDomElement(doc));
-    return doc.toByteArray(1); // indent only 1 space to save disk space
+    QByteArray output;
+    output.reserve(mSizeHint + mSizeHint / 8 + 1024);
+    output.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
+    mRootElement->writeToByteArray(output, 1); // indent only 1 space to save disk space
+    mSizeHint = output.size();
+    return output;
 }
 
 /*****************************************************************************************
@@ -24,7 +24,6 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
-#include <QDomDocument>
 #include "../exceptions.h"
 #include "filepath.h"
 
@@ -42,7 +41,6 @@ class XmlDomElement;
 /**
  * @brief The XmlDomDocument class represents a XML DOM document with the whole DOM tree
  *
- * @todo Use libxml2 instead of Qt's DOM classes
  * @todo Use XSD schema files to validate the opened XML file (with libxml2)
  * @todo Save the DOM document as canonical XML to file (with libxml2 c14n)
  *
@@ -149,6 +147,7 @@ class XmlDomDocument final
         // General
         FilePath mFilePath;             ///< the filepath from the constructor
         XmlDomElement* mRootElement;    ///< the root DOM element
+        mutable int mSizeHint;          ///< size of the last loaded/exported XML data (to preallocate memory)
 };
 
 /*****************************************************************************************
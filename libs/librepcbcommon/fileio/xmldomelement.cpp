@@ -39,34 +39,70 @@ namespace librepcb {
  ****************************************************************************************/
 
 XmlDomElement::XmlDomElement(const QString& name, const QString& text) noexcept :
-    mDocument(nullptr), mParent(nullptr), mName(name), mText(text)
+    mDocument(nullptr), mParent(nullptr), mPreviousSibling(nullptr), mNextSibling(nullptr),
+    mPreviousSameNameSibling(nullptr), mNextSameNameSibling(nullptr), mName(name),
+    mText(text), mFirstChild(nullptr), mLastChild(nullptr), mChildCount(0)
 {
     Q_ASSERT(isValidXmlTagName(mName) == true);
 }
 
-XmlDomElement::XmlDomElement(QDomElement domElement, XmlDomElement* parent, XmlDomDocument* doc) noexcept :
-    mDocument(doc), mParent(parent), mName(domElement.tagName()), mText()
+XmlDomElement::XmlDomElement(QXmlStreamReader& reader, XmlNameTable& names,
+                             XmlDomDocument* doc) noexcept :
+    mDocument(doc), mParent(nullptr), mPreviousSibling(nullptr), mNextSibling(nullptr),
+    mPreviousSameNameSibling(nullptr), mNextSameNameSibling(nullptr),
+    mName(internName(names, reader.name())), mText(), mFirstChild(nullptr),
+    mLastChild(nullptr), mChildCount(0)
 {
+    Q_ASSERT(reader.isStartElement());
     Q_ASSERT(isValidXmlTagName(mName) == true);
 
-    QDomNamedNodeMap map = domElement.attributes();
-    for (int i = 0; i < map.count(); i++)
-        mAttributes.insert(map.item(i).nodeName(), map.item(i).nodeValue());
+    QXmlStreamAttributes attributes = reader.attributes();
+    mAttributes.reserve(attributes.count());
+    foreach (const QXmlStreamAttribute& attribute, attributes)
+        mAttributes.append(qMakePair(internName(names, attribute.name()), attribute.value().toString()));
+    // our own files are already sorted, so this normally doesn't need to move anything
+    std::sort(mAttributes.begin(), mAttributes.end(),
+              [](const QPair<QString, QString>& a, const QPair<QString, QString>& b)
+              {return a.first < b.first;});
 
-    QDomElement child = domElement.firstChildElement();
-    while (!child.isNull())
+    QString text;
+    while (!reader.atEnd())
     {
-        mChilds.append(new XmlDomElement(child, this));
-        child = child.nextSiblingElement();
+        switch (reader.readNext())
+        {
+            case QXmlStreamReader::StartElement:
+                appendChild(new XmlDomElement(reader, names));
+                break;
+            case QXmlStreamReader::Characters:
+                if (!mFirstChild) text.append(reader.text());
+                break;
+            case QXmlStreamReader::EndElement:
+                // whitespace-only texts are ignored (same behaviour as QDomDocument)
+                if ((!mFirstChild) && (!text.trimmed().isEmpty()))
+                    mText = text;
+                return;
+            default:
+                break;
+        }
     }
-
-    if (mChilds.isEmpty())
-        mText = domElement.text();
+    // premature end of document or parse error, the caller must check the reader
 }
 
 XmlDomElement::~XmlDomElement() noexcept
 {
-    qDeleteAll(mChilds);        mChilds.clear();
+    XmlDomElement* child = mFirstChild;
+    while (child)
+    {
+        XmlDomElement* next = child->mNextSibling;
+        child->mParent = nullptr; // avoid removing the child from our list while iterating
+        delete child;
+        child = next;
+    }
+    mFirstChild = nullptr;
+    mLastChild = nullptr;
+    mChildCount = 0;
+    mFirstChildByName.clear();
+    mLastChildByName.clear();
 
     if (mParent)
         mParent->removeChild(this, false);
@@ -90,6 +126,13 @@ void XmlDomElement::setDocument(XmlDomDocument* doc) noexcept
     mDocument = doc;
 }
 
+void XmlDomElement::setName(const QString& name) noexcept
+{
+    Q_ASSERT(isValidXmlTagName(name));
+    mName = name;
+    if (mParent) mParent->rebuildChildNameIndex();
+}
+
 FilePath XmlDomElement::getDocFilePath() const noexcept
 {
     XmlDomDocument* doc = getDocument(true);
@@ -106,7 +149,7 @@ FilePath XmlDomElement::getDocFilePath() const noexcept
 template <>
 void XmlDomElement::setText<QString>(const QString& value) noexcept
 {
-    Q_ASSERT(mChilds.isEmpty() == true);
+    Q_ASSERT(hasChilds() == false);
     mText = value;
 }
 
@@ -270,7 +313,11 @@ Length XmlDomElement::getText<Length>(bool throwIfEmpty, const Length& defaultVa
 template <>
 void XmlDomElement::setAttribute(const QString& name, const QString& value) noexcept
 {
-    mAttributes.insert(name, value);
+    int index = lowerBoundOfAttribute(name);
+    if ((index < mAttributes.count()) && (mAttributes.at(index).first == name))
+        mAttributes[index].second = value;
+    else
+        mAttributes.insert(index, qMakePair(name, value));
 }
 
 template <>
@@ -341,7 +388,7 @@ void XmlDomElement::setAttribute(const QString& name, const VAlign& value) noexc
 
 bool XmlDomElement::hasAttribute(const QString& name) const noexcept
 {
-    return mAttributes.contains(name);
+    return (indexOfAttribute(name) >= 0);
 }
 
 template <>
@@ -350,17 +397,19 @@ QString XmlDomElement::getAttribute<QString>(const QString& name, bool throwIfEm
     Q_UNUSED(defaultValue);
     Q_ASSERT(defaultValue == QString()); // defaultValue makes no sense in this method
 
-    if (!mAttributes.contains(name))
+    int index = indexOfAttribute(name);
+    if (index < 0)
     {
         throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
             QString(tr("Attribute \"%1\" not found in node \"%2\".")).arg(name, mName));
     }
-    if (mAttributes.value(name).isEmpty() && throwIfEmpty)
+    const QString& value = mAttributes.at(index).second;
+    if (value.isEmpty() && throwIfEmpty)
     {
         throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
             QString(tr("Attribute \"%1\" in node \"%2\" must not be empty.")).arg(name, mName));
     }
-    return mAttributes.value(name);
+    return value;
 }
 
 template <>
@@ -558,10 +607,41 @@ VAlign XmlDomElement::getAttribute<VAlign>(const QString& name, bool throwIfEmpt
 void XmlDomElement::removeChild(XmlDomElement* child, bool deleteChild) noexcept
 {
     Q_ASSERT(child);
-    Q_ASSERT(mChilds.contains(child) == true);
-    mChilds.removeOne(child);
+    Q_ASSERT(child->mParent == this);
+
+    // unlink from the list of all childs
+    if (child->mPreviousSibling)
+        child->mPreviousSibling->mNextSibling = child->mNextSibling;
+    else
+        mFirstChild = child->mNextSibling;
+    if (child->mNextSibling)
+        child->mNextSibling->mPreviousSibling = child->mPreviousSibling;
+    else
+        mLastChild = child->mPreviousSibling;
+    mChildCount--;
+
+    // unlink from the list of childs with the same name
+    XmlDomElement* prevSameName = child->mPreviousSameNameSibling;
+    XmlDomElement* nextSameName = child->mNextSameNameSibling;
+    if (prevSameName)
+        prevSameName->mNextSameNameSibling = nextSameName;
+    else if (nextSameName)
+        mFirstChildByName.insert(child->mName, nextSameName);
+    else
+        mFirstChildByName.remove(child->mName);
+    if (nextSameName)
+        nextSameName->mPreviousSameNameSibling = prevSameName;
+    else if (prevSameName)
+        mLastChildByName.insert(child->mName, prevSameName);
+    else
+        mLastChildByName.remove(child->mName);
+
     child->mDocument = nullptr;
     child->mParent = nullptr;
+    child->mPreviousSibling = nullptr;
+    child->mNextSibling = nullptr;
+    child->mPreviousSameNameSibling = nullptr;
+    child->mNextSameNameSibling = nullptr;
     if (deleteChild)
         delete child;
 }
@@ -570,10 +650,32 @@ void XmlDomElement::appendChild(XmlDomElement* child) noexcept
 {
     Q_ASSERT(mText.isNull() == true);
     Q_ASSERT(child);
-    Q_ASSERT(mChilds.contains(child) == false);
     Q_ASSERT(child->mDocument == nullptr);
-    Q_ASSERT(child->mParent == nullptr);
-    mChilds.append(child);
+    Q_ASSERT(child->mParent == nullptr); // also ensures that it is not yet one of our childs
+    if (mLastChild)
+    {
+        child->mPreviousSibling = mLastChild;
+        mLastChild->mNextSibling = child;
+    }
+    else
+    {
+        mFirstChild = child;
+    }
+    mLastChild = child;
+    mChildCount++;
+    child->mParent = this;
+
+    XmlDomElement*& lastSameName = mLastChildByName[child->mName];
+    if (lastSameName)
+    {
+        child->mPreviousSameNameSibling = lastSameName;
+        lastSameName->mNextSameNameSibling = child;
+    }
+    else
+    {
+        mFirstChildByName.insert(child->mName, child);
+    }
+    lastSameName = child;
 }
 
 XmlDomElement* XmlDomElement::appendChild(const QString& name) noexcept
@@ -586,10 +688,8 @@ XmlDomElement* XmlDomElement::appendChild(const QString& name) noexcept
 template <>
 XmlDomElement* XmlDomElement::appendTextChild(const QString& name, const QString& value) noexcept
 {
-    Q_ASSERT(mText.isNull() == true);
     XmlDomElement* child = new XmlDomElement(name, value);
-    mChilds.append(child);
-    child->mParent = this;
+    appendChild(child);
     return child;
 }
 
@@ -631,8 +731,8 @@ XmlDomElement* XmlDomElement::appendTextChild(const QString& name, const Length&
 
 XmlDomElement* XmlDomElement::getFirstChild(bool throwIfNotFound) const throw (Exception)
 {
-    if (!mChilds.isEmpty())
-        return mChilds.first();
+    if (mFirstChild)
+        return mFirstChild;
     else if (!throwIfNotFound)
         return nullptr;
     else
@@ -644,12 +744,10 @@ XmlDomElement* XmlDomElement::getFirstChild(bool throwIfNotFound) const throw (E
 
 XmlDomElement* XmlDomElement::getFirstChild(const QString& name, bool throwIfNotFound) const throw (Exception)
 {
-    foreach (XmlDomElement* child, mChilds)
-    {
-        if (child->getName() == name)
-            return child;
-    }
-    if (!throwIfNotFound)
+    XmlDomElement* child = mFirstChildByName.value(name, nullptr);
+    if (child)
+        return child;
+    else if (!throwIfNotFound)
         return nullptr;
     else
     {
@@ -681,42 +779,34 @@ XmlDomElement* XmlDomElement::getFirstChild(const QString& pathName, bool throwI
 XmlDomElement* XmlDomElement::getPreviousChild(const XmlDomElement* child, const QString& name,
                                                bool throwIfNotFound) const throw (Exception)
 {
-    XmlDomElement* previousChild = const_cast<XmlDomElement*>(child);
-    do
+    Q_ASSERT(child && (child->mParent == this));
+    XmlDomElement* previousChild = child->mPreviousSibling;
+    if ((!name.isNull()) && (child->mName == name))
+        previousChild = child->mPreviousSameNameSibling;
+    while ((previousChild) && (!name.isNull()) && (previousChild->getName() != name))
+        previousChild = previousChild->mPreviousSibling;
+    if ((!previousChild) && (throwIfNotFound))
     {
-        int index = mChilds.indexOf(const_cast<XmlDomElement*>(previousChild));
-        Q_ASSERT(index > -1);
-        if (index > 0)
-            previousChild = mChilds.at(index-1);
-        else if (!throwIfNotFound)
-            return nullptr;
-        else
-        {
-            throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
-                QString(tr("Child \"%1\" of node \"%2\" not found.")).arg(name, mName));
-        }
-    } while ((previousChild->getName() != name) && (!name.isNull()));
+        throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
+            QString(tr("Child \"%1\" of node \"%2\" not found.")).arg(name, mName));
+    }
     return previousChild;
 }
 
 XmlDomElement* XmlDomElement::getNextChild(const XmlDomElement* child, const QString& name,
                                            bool throwIfNotFound) const throw (Exception)
 {
-    XmlDomElement* nextChild = const_cast<XmlDomElement*>(child);
-    do
+    Q_ASSERT(child && (child->mParent == this));
+    XmlDomElement* nextChild = child->mNextSibling;
+    if ((!name.isNull()) && (child->mName == name))
+        nextChild = child->mNextSameNameSibling; // fast path for iterating over a list
+    while ((nextChild) && (!name.isNull()) && (nextChild->getName() != name))
+        nextChild = nextChild->mNextSibling;
+    if ((!nextChild) && (throwIfNotFound))
     {
-        int index = mChilds.indexOf(const_cast<XmlDomElement*>(nextChild));
-        Q_ASSERT(index > -1);
-        if (index < mChilds.count()-1)
-            nextChild = mChilds.at(index+1);
-        else if (!throwIfNotFound)
-            return nullptr;
-        else
-        {
-            throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
-                QString(tr("Child \"%1\" of node \"%2\" not found.")).arg(name, mName));
-        }
-    } while ((nextChild->getName() != name) && (!name.isNull()));
+        throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
+            QString(tr("Child \"%1\" of node \"%2\" not found.")).arg(name, mName));
+    }
     return nextChild;
 }
 
@@ -751,35 +841,60 @@ XmlDomElement* XmlDomElement::getNextSibling(const QString& name, bool throwIfNo
 }
 
 /*****************************************************************************************
- *  QDomElement Converter Methods
+ *  Serialization Methods
  ****************************************************************************************/
 
-QDomElement XmlDomElement::toQDomElement(QDomDocument& domDocument) const noexcept
+void XmlDomElement::writeToByteArray(QByteArray& output, int indent, int depth) const noexcept
 {
-    QDomElement element = domDocument.createElement(mName);
+    QByteArray indentation(depth * indent, ' ');
+    QByteArray name = mName.toUtf8();
+
+    output.append(indentation);
+    output.append('<');
+    output.append(name);
+
+    foreach (const auto& attribute, mAttributes) // already sorted by name
+    {
+        output.append(' ');
+        output.append(attribute.first.toUtf8());
+        output.append("=\"");
+        appendEscaped(output, attribute.second, true);
+        output.append('"');
+    }
 
     if (hasChilds())
     {
-        foreach (XmlDomElement* child, mChilds)
-            element.appendChild(child->toQDomElement(domDocument));
+        output.append(">\n");
+        for (const XmlDomElement* child = mFirstChild; child; child = child->mNextSibling)
+            child->writeToByteArray(output, indent, depth + 1);
+        output.append(indentation);
+        output.append("</");
+        output.append(name);
+        output.append('>');
     }
     else if (!mText.isNull())
     {
-        QDomText textNode = domDocument.createTextNode(mText);
-        element.appendChild(textNode);
+        output.append('>');
+        appendEscaped(output, mText, false);
+        output.append("</");
+        output.append(name);
+        output.append('>');
     }
-
-    foreach (const QString& key, mAttributes.keys())
+    else
     {
-        element.setAttribute(key, mAttributes.value(key));
+        output.append("/>");
     }
-
-    return element;
+    output.append('\n');
 }
 
-XmlDomElement* XmlDomElement::fromQDomElement(QDomElement domElement, XmlDomDocument* doc) noexcept
+/*****************************************************************************************
+ *  QXmlStreamReader Converter Methods
+ ****************************************************************************************/
+
+XmlDomElement* XmlDomElement::fromXmlStreamReader(QXmlStreamReader& reader, XmlDomDocument* doc) noexcept
 {
-    return new XmlDomElement(domElement, nullptr, doc);
+    XmlNameTable names; // share the tag/attribute name strings within the whole tree
+    return new XmlDomElement(reader, names, doc);
 }
 
 /*****************************************************************************************
@@ -803,6 +918,78 @@ bool XmlDomElement::isValidXmlTagName(const QString& name) noexcept
     return valid;
 }
 
+int XmlDomElement::indexOfAttribute(const QString& name) const noexcept
+{
+    int index = lowerBoundOfAttribute(name);
+    if ((index < mAttributes.count()) && (mAttributes.at(index).first == name))
+        return index;
+    else
+        return -1;
+}
+
+int XmlDomElement::lowerBoundOfAttribute(const QString& name) const noexcept
+{
+    auto it = std::lower_bound(mAttributes.constBegin(), mAttributes.constEnd(), name,
+                               [](const QPair<QString, QString>& attr, const QString& n)
+                               {return attr.first < n;});
+    return it - mAttributes.constBegin();
+}
+
+QString XmlDomElement::internName(XmlNameTable& names, const QStringRef& name) noexcept
+{
+    uint hash = qHash(name);
+    XmlNameTable::const_iterator it = names.constFind(hash);
+    if ((it != names.constEnd()) && (*it == name))
+        return *it; // implicitly shared, no memory allocation
+    QString str = name.toString();
+    if (it == names.constEnd())
+        names.insert(hash, str);
+    return str;
+}
+
+void XmlDomElement::rebuildChildNameIndex() noexcept
+{
+    mFirstChildByName.clear();
+    mLastChildByName.clear();
+    for (XmlDomElement* child = mFirstChild; child; child = child->mNextSibling)
+    {
+        XmlDomElement*& lastSameName = mLastChildByName[child->mName];
+        child->mPreviousSameNameSibling = lastSameName;
+        child->mNextSameNameSibling = nullptr;
+        if (lastSameName)
+            lastSameName->mNextSameNameSibling = child;
+        else
+            mFirstChildByName.insert(child->mName, child);
+        lastSameName = child;
+    }
+}
+
+void XmlDomElement::appendEscaped(QByteArray& output, const QString& str, bool isAttribute) noexcept
+{
+    // all special characters are ASCII, so we can escape them directly in the UTF-8 data
+    QByteArray utf8 = str.toUtf8();
+    for (int i = 0; i < utf8.length(); i++)
+    {
+        char c = utf8.at(i);
+        switch (c)
+        {
+            case '<':   output.append("&lt;"); break;
+            case '&':   output.append("&amp;"); break;
+            case '"':   if (isAttribute) output.append("&quot;"); else output.append(c); break;
+            case '>':
+                if ((i >= 2) && (utf8.at(i-1) == ']') && (utf8.at(i-2) == ']'))
+                    output.append("&gt;"); // "]]>" is not allowed in texts
+                else
+                    output.append(c);
+                break;
+            case '\n':  if (isAttribute) output.append("&#xa;"); else output.append(c); break;
+            case '\r':  output.append("&#xd;"); break; // would be normalized away by the parser
+            case '\t':  if (isAttribute) output.append("&#x9;"); else output.append(c); break;
+            default:    output.append(c); break;
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
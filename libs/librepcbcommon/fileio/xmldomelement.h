@@ -24,7 +24,6 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
-#include <QDomElement>
 #include "../exceptions.h"
 #include "filepath.h"
 
@@ -53,11 +52,17 @@ class XmlDomDocument;
  * </root_element>
  * @endcode
  *
+ * @note All childs are linked with their siblings (and with their siblings of the same
+ *       tag name) and indexed by their tag name, so iterating over childs with
+ *       #getNextSibling() resp. #getNextChild(), looking up a child with
+ *       #getFirstChild() and appending/removing childs doesn't depend on the child count.
+ *       The attributes are kept sorted by name, so they can be looked up by binary
+ *       search and written to a file without sorting them again.
+ *
  * @note This class provides some template methods to call them with different types.
  *       We don't use method overloading because this way we don't need to include
  *       the header files for our own types (e.g. #Uuid, #Version, ...).
  *
- * @todo Use libxml2 instead of Qt's DOM classes.
  * @todo Add more template instances (provide more type conversions from/to QString)
  *
  * @author ubruhin
@@ -139,7 +144,7 @@ class XmlDomElement final
          *
          * @param name  The new name (see #isValidXmlTagName() for allowed characters)
          */
-        void setName(const QString& name) noexcept {Q_ASSERT(isValidXmlTagName(name)); mName = name;}
+        void setName(const QString& name) noexcept;
 
 
         // Text Handling Methods
@@ -233,14 +238,14 @@ class XmlDomElement final
          * @retval true     If this element has child elements
          * @retval false    If this element has no child elements
          */
-        bool hasChilds() const noexcept {return !mChilds.isEmpty();}
+        bool hasChilds() const noexcept {return (mFirstChild != nullptr);}
 
         /**
          * @brief Get the child count of this element
          *
          * @return  The count of child elements
          */
-        int getChildCount() const noexcept {return mChilds.count();}
+        int getChildCount() const noexcept {return mChildCount;}
 
         /**
          * @brief Remove a child element from the DOM tree
@@ -413,31 +418,57 @@ class XmlDomElement final
                                       bool throwIfNotFound = false) const throw (Exception);
 
 
-        // QDomElement Converter Methods
+        // Serialization Methods
 
         /**
-         * @brief Construct a QDomElement object from this XmlDomElement (recursively)
+         * @brief Write this element (recursively) as XML into a byte array
          *
-         * @param domDocument   The DOM Document of the newly created QDomElement
+         * The output is UTF-8 encoded and uses the same formatting as
+         * QDomDocument::toByteArray(), but without building an intermediate QDomDocument.
+         * Attributes are written in alphabetical order to get a stable output.
          *
-         * @return The created QDomElement (which is added to the specified DOM document)
+         * @param output    The byte array to append the XML data to
+         * @param indent    Count of spaces per indentation level
+         * @param depth     The indentation level of this element
          */
-        QDomElement toQDomElement(QDomDocument& domDocument) const noexcept;
+        void writeToByteArray(QByteArray& output, int indent, int depth = 0) const noexcept;
+
+
+        // QXmlStreamReader Converter Methods
 
         /**
-         * @brief Construct a XmlDomElement object from a QDomElement object (recursively)
+         * @brief Construct a XmlDomElement object directly from a QXmlStreamReader (recursively)
+         *
+         * The reader must be positioned on a start element. This method reads the whole
+         * element (including all childs) and leaves the reader positioned on the
+         * corresponding end element. No intermediate DOM tree is built.
+         *
+         * @note    If the reader runs into an error, the returned tree is incomplete.
+         *          The caller is responsible to check QXmlStreamReader::hasError()!
          *
-         * @param domElement    The QDomElement to copy
+         * @param reader        The XML stream reader (positioned on a start element)
          * @param doc           The DOM Document of the newly created XmlDomElement (only
          *                      needed for the root element)
          *
          * @return The created XmlDomElement (the caller takes the ownership!)
          */
-        static XmlDomElement* fromQDomElement(QDomElement domElement, XmlDomDocument* doc = nullptr) noexcept;
+        static XmlDomElement* fromXmlStreamReader(QXmlStreamReader& reader, XmlDomDocument* doc = nullptr) noexcept;
 
 
     private:
 
+        // Types
+
+        /**
+         * @brief Table of tag and attribute names (key: qHash() of the name)
+         *
+         * While parsing a file, all elements and attributes with the same name share the
+         * same (implicitly shared) QString object. As there are only very few different
+         * names per file type, this avoids a lot of memory allocations.
+         */
+        typedef QHash<uint, QString> XmlNameTable;
+
+
         // make some methods inaccessible...
         XmlDomElement() = delete;
         XmlDomElement(const XmlDomElement& other) = delete;
@@ -447,14 +478,14 @@ class XmlDomElement final
         // Private Methods
 
         /**
-         * @brief Private constructor to create a XmlDomElement from a QDomElement
+         * @brief Private constructor to create a XmlDomElement from a QXmlStreamReader
          *
-         * @param domElement    The QDomElement to copy
-         * @param parent        The parent of the newly created XmlDomElement
+         * @param reader        The XML stream reader (positioned on a start element)
+         * @param names         The name table of the whole tree (see #XmlNameTable)
          * @param doc           The DOM Document of the newly created XmlDomElement (only
          *                      needed for the root element)
          */
-        explicit XmlDomElement(QDomElement domElement, XmlDomElement* parent = nullptr,
+        explicit XmlDomElement(QXmlStreamReader& reader, XmlNameTable& names,
                                XmlDomDocument* doc = nullptr) noexcept;
 
         /**
@@ -472,14 +503,72 @@ class XmlDomElement final
          */
         static bool isValidXmlTagName(const QString& name) noexcept;
 
+        /**
+         * @brief Append a string to a byte array (UTF-8) and escape special characters
+         *
+         * @param output        The byte array to append the escaped string to
+         * @param str           The string to escape
+         * @param isAttribute   If true, quotes, line breaks and tabs are escaped too
+         *                      (required for attribute values to survive attribute value
+         *                      normalization)
+         *
+         * The output is identical to the one of QDomDocument::toByteArray(): carriage
+         * returns are always escaped (also in texts) because the parser would normalize
+         * them away otherwise.
+         */
+        static void appendEscaped(QByteArray& output, const QString& str, bool isAttribute) noexcept;
+
+
+        /**
+         * @brief Get the index of an attribute in #mAttributes (binary search)
+         *
+         * @param name  The name of the attribute
+         *
+         * @return The index of the attribute, or -1 if not found
+         */
+        int indexOfAttribute(const QString& name) const noexcept;
+
+        /**
+         * @brief Get the index in #mAttributes where an attribute has to be inserted
+         *
+         * @param name  The name of the attribute
+         *
+         * @return The index of the first attribute whose name is not less than "name"
+         */
+        int lowerBoundOfAttribute(const QString& name) const noexcept;
+
+        /**
+         * @brief Get the shared QString object of a tag/attribute name from a name table
+         *
+         * @param names The name table (the name is added if it doesn't exist yet)
+         * @param name  The name to look up
+         *
+         * @return The name as a QString (shared with all other elements of the tree)
+         */
+        static QString internName(XmlNameTable& names, const QStringRef& name) noexcept;
+
+        /**
+         * @brief Rebuild the indices #mFirstChildByName and #mLastChildByName and the
+         *        links between the childs of the same name from the list of childs
+         */
+        void rebuildChildNameIndex() noexcept;
+
 
         // Attributes
         XmlDomDocument* mDocument;  ///< the DOM document of the tree (only needed in the root node, otherwise nullptr)
         XmlDomElement* mParent;     ///< the parent element (if available, otherwise nullptr)
+        XmlDomElement* mPreviousSibling;    ///< the previous child of the parent (or nullptr)
+        XmlDomElement* mNextSibling;        ///< the next child of the parent (or nullptr)
+        XmlDomElement* mPreviousSameNameSibling;    ///< the previous child of the parent with the same name (or nullptr)
+        XmlDomElement* mNextSameNameSibling;        ///< the next child of the parent with the same name (or nullptr)
         QString mName;              ///< the tag name of this element
         QString mText;              ///< the text of this element (only if there are no childs)
-        QList<XmlDomElement*> mChilds;      ///< all child elements (only if there is no text)
-        QHash<QString, QString> mAttributes;///< all attributes of this element (key, value) in arbitrary order
+        XmlDomElement* mFirstChild;         ///< the first child element (only if there is no text)
+        XmlDomElement* mLastChild;          ///< the last child element (only if there is no text)
+        int mChildCount;                    ///< the count of child elements
+        QHash<QString, XmlDomElement*> mFirstChildByName;   ///< the first child of each tag name (for fast lookups)
+        QHash<QString, XmlDomElement*> mLastChildByName;    ///< the last child of each tag name (for fast appending)
+        QVector<QPair<QString, QString>> mAttributes;  ///< all attributes of this element (name, value) sorted by name
 };
 
 /*****************************************************************************************
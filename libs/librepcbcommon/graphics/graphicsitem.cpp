@@ -23,12 +23,19 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "graphicsitem.h"
+#include "graphicsscene.h"
 
 /*****************************************************************************************
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Static Attributes
+ ****************************************************************************************/
+
+GraphicsItem::LodThresholds_t GraphicsItem::sLodThresholds = {8, 4, 8, 2};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -40,6 +47,35 @@ GraphicsItem::GraphicsItem() noexcept :
 
 GraphicsItem::~GraphicsItem() noexcept
 {
+    GraphicsScene* graphicsScene = qobject_cast<GraphicsScene*>(scene());
+    if (graphicsScene) graphicsScene->cancelCacheUpdate(*this);
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void GraphicsItem::scheduleCacheUpdate() noexcept
+{
+    GraphicsScene* graphicsScene = qobject_cast<GraphicsScene*>(scene());
+    if (graphicsScene) {
+        graphicsScene->scheduleCacheUpdate(*this);
+    } else {
+        updateCacheAndRepaint();
+    }
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void GraphicsItem::setLodThresholds(const LodThresholds_t& thresholds) noexcept
+{
+    Q_ASSERT(thresholds.textHeight >= 0);
+    Q_ASSERT(thresholds.padSize >= 0);
+    Q_ASSERT(thresholds.itemSize >= 0);
+    Q_ASSERT(thresholds.lineWidth >= 0);
+    sLodThresholds = thresholds;
 }
 
 /*****************************************************************************************
@@ -37,14 +37,67 @@ namespace librepcb {
 
 /**
  * @brief The GraphicsItem class
+ *
+ * All graphics items use the same level of detail thresholds (see #LodThresholds_t) to
+ * decide whether they are drawn with all details or only simplified. This keeps the
+ * scene responsive if many items are visible at once (e.g. after zooming out a big board).
+ *
+ * While items are moved interactively, their cached geometry (bounding rect, shape, ...)
+ * is often invalidated many times per mouse event (e.g. a net line attached to several
+ * moved net points). Such items should call #scheduleCacheUpdate() instead of
+ * #updateCacheAndRepaint(), then the #GraphicsScene recalculates the cache of each
+ * invalidated item only once before the next repaint.
  */
 class GraphicsItem : public QGraphicsItem
 {
     public:
 
+        // Types
+
+        /**
+         * @brief Minimum sizes (in screen pixels) to draw the details of an item
+         *
+         * An item which is smaller than the corresponding threshold is drawn simplified
+         * (a threshold of zero means that the item is always drawn with all details).
+         * These thresholds are not used for printing.
+         */
+        struct LodThresholds_t {
+            qreal textHeight;   ///< smaller texts are drawn as boxes
+            qreal padSize;      ///< smaller pads are drawn as filled rects
+            qreal itemSize;     ///< smaller symbols/footprints are drawn as bounding rect
+            qreal lineWidth;    ///< thinner lines are drawn as hairlines
+        };
+
         // Constructors / Destructor
         explicit GraphicsItem() noexcept;
         virtual ~GraphicsItem() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Recalculate all cached attributes of the item and repaint it
+         */
+        virtual void updateCacheAndRepaint() noexcept = 0;
+
+        /**
+         * @brief Request a (deferred) call of #updateCacheAndRepaint()
+         *
+         * If the item is added to a #GraphicsScene, the cache update is postponed until the
+         * scene processes its scheduled updates (see
+         * GraphicsScene#processScheduledCacheUpdates()), so calling this method several
+         * times leads to only one update. Otherwise the cache is updated immediately.
+         */
+        void scheduleCacheUpdate() noexcept;
+
+        // Static Methods
+        static const LodThresholds_t& getLodThresholds() noexcept {return sLodThresholds;}
+        static void setLodThresholds(const LodThresholds_t& thresholds) noexcept;
+
+
+    private:
+
+        // Static Attributes
+        static LodThresholds_t sLodThresholds;
 };
 
 /*****************************************************************************************
@@ -67,7 +67,9 @@ void GraphicsScene::addItem(GraphicsItem& item) noexcept
 
 void GraphicsScene::removeItem(GraphicsItem& item) noexcept
 {
+    bool updateScheduled = mScheduledCacheUpdates.remove(&item);
     QGraphicsScene::removeItem(&item);
+    if (updateScheduled) item.updateCacheAndRepaint(); // keep the removed item consistent
 }
 
 void GraphicsScene::setSelectionRect(const Point& p1, const Point& p2) noexcept
@@ -76,6 +78,30 @@ void GraphicsScene::setSelectionRect(const Point& p1, const Point& p2) noexcept
     mSelectionRectItem->setRect(rectPx);
 }
 
+void GraphicsScene::scheduleCacheUpdate(GraphicsItem& item) noexcept
+{
+    Q_ASSERT(item.scene() == this);
+    if (mScheduledCacheUpdates.isEmpty()) {
+        QMetaObject::invokeMethod(this, "processScheduledCacheUpdates", Qt::QueuedConnection);
+    }
+    mScheduledCacheUpdates.insert(&item);
+}
+
+void GraphicsScene::cancelCacheUpdate(GraphicsItem& item) noexcept
+{
+    mScheduledCacheUpdates.remove(&item);
+}
+
+void GraphicsScene::processScheduledCacheUpdates() noexcept
+{
+    // swap the set first, the items might schedule new updates while updating themselves
+    QSet<GraphicsItem*> items;
+    items.swap(mScheduledCacheUpdates);
+    foreach (GraphicsItem* item, items) {
+        item->updateCacheAndRepaint();
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -40,6 +40,10 @@ class GraphicsItem;
 
 /**
  * @brief The GraphicsScene class
+ *
+ * The scene collects all items which requested a deferred cache update (see
+ * GraphicsItem#scheduleCacheUpdate()) and updates each of them exactly once as soon as the
+ * event loop is idle again, i.e. before the next repaint of the views.
  */
 class GraphicsScene final : public QGraphicsScene
 {
@@ -55,11 +59,25 @@ class GraphicsScene final : public QGraphicsScene
         void addItem(GraphicsItem& item) noexcept;
         void removeItem(GraphicsItem& item) noexcept;
         void setSelectionRect(const Point& p1, const Point& p2) noexcept;
+        void scheduleCacheUpdate(GraphicsItem& item) noexcept;
+        void cancelCacheUpdate(GraphicsItem& item) noexcept;
+
+
+    public slots:
+
+        /**
+         * @brief Update the caches of all items which have requested a deferred update
+         *
+         * This is called automatically by the event loop, but must also be called
+         * before the geometry of the items is accessed directly (hit-tests, rendering).
+         */
+        void processScheduledCacheUpdates() noexcept;
 
 
     private:
 
         QGraphicsRectItem* mSelectionRectItem;
+        QSet<GraphicsItem*> mScheduledCacheUpdates;
 };
 
 /*****************************************************************************************
@@ -40,10 +40,10 @@ namespace librepcb {
 GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHandler) noexcept :
     QGraphicsView(parent), mEventHandlerObject(eventHandler), mScene(nullptr),
     mZoomAnimation(nullptr), mGridProperties(new GridProperties()), mOriginCrossVisible(true),
-    mUseOpenGl(false), mPanningActive(false)
+    mUseOpenGl(false), mPartialViewportUpdate(true), mPanningActive(false)
 {
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    updateViewportUpdateMode();
     setOptimizationFlags(QGraphicsView::DontSavePainterState);
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -83,9 +83,16 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
         else
             setViewport(nullptr);
         mUseOpenGl = useOpenGl;
+        updateViewportUpdateMode();
     }
 }
 
+void GraphicsView::setPartialViewportUpdate(bool partial) noexcept
+{
+    mPartialViewportUpdate = partial;
+    updateViewportUpdateMode();
+}
+
 void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 {
     *mGridProperties = properties;
@@ -245,55 +252,38 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
 {
-    QPen gridPen(Qt::gray);
-    gridPen.setCosmetic(true);
-
     // draw background color
     painter->setPen(Qt::NoPen);
     painter->setBrush(backgroundBrush());
     painter->fillRect(rect, backgroundBrush());
 
-    // draw background grid lines
-    gridPen.setWidth((mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-    painter->setPen(gridPen);
-    painter->setBrush(Qt::NoBrush);
+    // draw background grid (note: "rect" may be only a small part of the viewport!)
+    if (mGridProperties->getType() == GridProperties::Type_t::Off) return;
     qreal gridIntervalPixels = mGridProperties->getInterval().toPx();
-    qreal scaleFactor = width() / rect.width();
-    if (gridIntervalPixels * scaleFactor >= (qreal)5)
-    {
-        qreal left, right, top, bottom;
-        left = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
-        right = rect.right();
-        top = rect.top();
-        bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
-        switch (mGridProperties->getType())
-        {
-            case GridProperties::Type_t::Lines:
-            {
-                QVarLengthArray<QLineF, 500> lines;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    lines.append(QLineF(x, rect.top(), x, rect.bottom()));
-                for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                    lines.append(QLineF(rect.left(), y, rect.right(), y));
-                painter->setOpacity(0.5);
-                painter->drawLines(lines.data(), lines.size());
-                break;
-            }
-
-            case GridProperties::Type_t::Dots:
-            {
-                QVarLengthArray<QPointF, 2000> dots;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                        dots.append(QPointF(x, y));
-                painter->drawPoints(dots.data(), dots.size());
-                break;
-            }
-
-            default:
-                break;
+    qreal scaleFactor = qAbs(transform().m11());
+    if (gridIntervalPixels * scaleFactor < (qreal)5) return;
+    qreal tileSize;
+    QPixmap tile = getGridTile(gridIntervalPixels, scaleFactor, tileSize);
+    if (tile.isNull()) return;
+
+    // the tiles are aligned to the scene origin, so all tiles look exactly the same
+    int left = qFloor(rect.left() / tileSize);
+    int right = qFloor(rect.right() / tileSize);
+    int top = qFloor(rect.top() / tileSize);
+    int bottom = qFloor(rect.bottom() / tileSize);
+    // the tile size in device pixels is rounded, so smooth the scaling only if the tile
+    // does not exactly match the device pixels (otherwise keep the lines sharp)
+    qreal tileSizeOnDevice = tileSize * scaleFactor * tile.devicePixelRatio();
+    bool smooth = qAbs(tile.width() - tileSizeOnDevice) > 0.01;
+    painter->save();
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, smooth);
+    for (int x = left; x <= right; ++x) {
+        for (int y = top; y <= bottom; ++y) {
+            painter->drawPixmap(QRectF(x * tileSize, y * tileSize, tileSize, tileSize),
+                                tile, QRectF(tile.rect()));
         }
     }
+    painter->restore();
 }
 
 void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
@@ -312,6 +302,81 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
     }
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void GraphicsView::updateViewportUpdateMode() noexcept
+{
+    // OpenGL viewports do not preserve their content, so they must always be fully updated
+    if (mPartialViewportUpdate && (!mUseOpenGl))
+        setViewportUpdateMode(QGraphicsView::BoundingRectViewportUpdate);
+    else
+        setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+}
+
+QPixmap GraphicsView::getGridTile(qreal gridIntervalPx, qreal scaleFactor,
+                                  qreal& tileSizePx) const noexcept
+{
+    // a tile contains an integer count of grid intervals and has a size of at least
+    // sGridTileMinSize pixels on the screen
+    qreal intervalOnScreen = gridIntervalPx * scaleFactor;
+    int count = qMax(1, qCeil(sGridTileMinSize / intervalOnScreen));
+    tileSizePx = count * gridIntervalPx;
+
+    // render the tile in device pixels to get sharp grids on high DPI screens
+    int dpr = qMax(1, devicePixelRatio());
+    int size = qRound(count * intervalOnScreen * dpr);
+
+    // the tiles are shared between all views with the same zoom level, grid type and
+    // device pixel ratio
+    QString key = QString("librepcb_grid_tile_%1_%2_%3_%4").arg(int(mGridProperties->getType()))
+                  .arg(count).arg(size).arg(dpr);
+    QPixmap tile;
+    if (QPixmapCache::find(key, &tile)) return tile;
+
+    // render the tile (grid lines/dots which are on the tile edges are drawn on both
+    // edges to get seamless tiles)
+    qreal step = qreal(size) / count;
+    tile = QPixmap(size, size);
+    tile.fill(Qt::transparent);
+    QPainter painter(&tile);
+    switch (mGridProperties->getType())
+    {
+        case GridProperties::Type_t::Lines:
+        {
+            QVarLengthArray<QLine, 500> lines;
+            for (int i = 0; i <= count; ++i) {
+                int pos = qRound(i * step);
+                lines.append(QLine(pos, 0, pos, size));
+                lines.append(QLine(0, pos, size, pos));
+            }
+            painter.setPen(QPen(Qt::gray, 0));
+            painter.setOpacity(0.5);
+            painter.drawLines(lines.data(), lines.size());
+            break;
+        }
+
+        case GridProperties::Type_t::Dots:
+        {
+            for (int i = 0; i <= count; ++i) {
+                for (int j = 0; j <= count; ++j) {
+                    QPoint pos(qRound(i * step), qRound(j * step));
+                    painter.fillRect(QRect(pos - QPoint(dpr, dpr), QSize(2*dpr, 2*dpr)), Qt::gray);
+                }
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+    painter.end();
+    tile.setDevicePixelRatio(dpr);
+    QPixmapCache::insert(key, tile);
+    return tile;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -42,6 +42,11 @@ class GridProperties;
 
 /**
  * @brief The GraphicsView class
+ *
+ * By default, only the bounding rects of changed items are repainted (except if OpenGL
+ * is used, which requires full viewport updates). To keep these partial updates cheap,
+ * the background grid is not drawn line by line, but with pixmap tiles which are
+ * pre-rendered once per zoom level and grid type (see #getGridTile()).
  */
 class GraphicsView final : public QGraphicsView
 {
@@ -58,10 +63,12 @@ class GraphicsView final : public QGraphicsView
         GraphicsScene* getScene() const noexcept {return mScene;}
         QRectF getVisibleSceneRect() const noexcept;
         bool getUseOpenGl() const noexcept {return mUseOpenGl;}
+        bool getPartialViewportUpdate() const noexcept {return mPartialViewportUpdate;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
 
         // Setters
         void setUseOpenGl(bool useOpenGl) noexcept;
+        void setPartialViewportUpdate(bool partial) noexcept;
         void setGridProperties(const GridProperties& properties) noexcept;
         void setScene(GraphicsScene* scene) noexcept;
         void setVisibleSceneRect(const QRectF& rect) noexcept;
@@ -93,6 +100,10 @@ class GraphicsView final : public QGraphicsView
         GraphicsView(const GraphicsView& other) = delete;
         GraphicsView& operator=(const GraphicsView& rhs) = delete;
 
+        // Private Methods
+        void updateViewportUpdateMode() noexcept;
+        QPixmap getGridTile(qreal gridIntervalPx, qreal scaleFactor, qreal& tileSizePx) const noexcept;
+
         // Inherited Methods
         bool eventFilter(QObject* obj, QEvent* event);
         void drawBackground(QPainter* painter, const QRectF& rect);
@@ -106,10 +117,12 @@ class GraphicsView final : public QGraphicsView
         GridProperties* mGridProperties;
         bool mOriginCrossVisible;
         bool mUseOpenGl;
+        bool mPartialViewportUpdate;
         volatile bool mPanningActive;
 
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
+        static constexpr int sGridTileMinSize = 256; ///< minimum grid tile size [pixels]
 };
 
 /*****************************************************************************************
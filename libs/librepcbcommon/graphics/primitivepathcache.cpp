@@ -0,0 +1,122 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "primitivepathcache.h"
+#include "../geometry/polygon.h"
+#include "../geometry/ellipse.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+QHash<const void*, QWeakPointer<const PrimitivePathCache>> PrimitivePathCache::sSharedCaches;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+PrimitivePathCache::PrimitivePathCache() noexcept
+{
+}
+
+PrimitivePathCache::~PrimitivePathCache() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void PrimitivePathCache::addPolygon(const Polygon& polygon) noexcept
+{
+    addPath(polygon.getLayerId(), polygon.getLineWidth(), polygon.isFilled(),
+            polygon.isGrabArea(), polygon.toQPainterPathPx());
+}
+
+void PrimitivePathCache::addEllipse(const Ellipse& ellipse) noexcept
+{
+    // TODO: rotation
+    QPainterPath path;
+    path.addEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
+                    ellipse.getRadiusY().toPx());
+    addPath(ellipse.getLayerId(), ellipse.getLineWidth(), ellipse.isFilled(),
+            ellipse.isGrabArea(), path);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void PrimitivePathCache::addPath(int layerId, const Length& lineWidth, bool isFilled,
+                                 bool isGrabArea, const QPainterPath& path) noexcept
+{
+    // only merge with the previous group to keep the drawing order of the primitives
+    if (!mGroups.isEmpty()) {
+        Group_t& last = mGroups.last();
+        if ((last.layerId == layerId) && (last.lineWidth == lineWidth)
+            && (last.isFilled == isFilled) && (last.isGrabArea == isGrabArea)
+            && (last.path.fillRule() == path.fillRule()))
+        {
+            // The fill rule applies to the whole merged path, so overlapping areas
+            // could cancel each other out. This only matters if the area is used,
+            // i.e. if it is filled or a grab area.
+            bool areaIsUsed = isFilled || isGrabArea;
+            bool overlaps = last.path.controlPointRect().intersects(path.controlPointRect());
+            if ((!areaIsUsed) || (!overlaps)) {
+                last.path.addPath(path);
+                return;
+            }
+        }
+    }
+    mGroups.append(Group_t{layerId, lineWidth, isFilled, isGrabArea, path});
+}
+
+QSharedPointer<const PrimitivePathCache> PrimitivePathCache::findSharedCache(const void* key) noexcept
+{
+    return sSharedCaches.value(key).toStrongRef();
+}
+
+QSharedPointer<const PrimitivePathCache> PrimitivePathCache::addSharedCache(const void* key,
+    PrimitivePathCache* cache) noexcept
+{
+    // remove the cache from the list as soon as it is no longer used, as the key could
+    // be reused by another library element later
+    QSharedPointer<const PrimitivePathCache> ptr(cache, [key](const PrimitivePathCache* c){
+        sSharedCaches.remove(key);
+        delete c;
+    });
+    sSharedCaches.insert(key, ptr);
+    return ptr;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PRIMITIVEPATHCACHE_H
+#define LIBREPCB_PRIMITIVEPATHCACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "../units/all_length_units.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Polygon;
+class Ellipse;
+
+/*****************************************************************************************
+ *  Class PrimitivePathCache
+ ****************************************************************************************/
+
+/**
+ * @brief The PrimitivePathCache class holds prebuilt painter paths of all polygons and
+ *        ellipses of a library element (e.g. a symbol or a footprint)
+ *
+ * Consecutive primitives with the same layer, line width, fill and grab area properties
+ * are merged into a single path, so graphics items only need to look up the layer and
+ * set up pen and brush once per group instead of once per primitive. Filled primitives
+ * and grab areas are only merged if their paths have the same fill rule and do not
+ * overlap, so the filled area is exactly the same as if they were drawn one by one.
+ *
+ * The cache contains only layer IDs, no colors and no visibility, so it never needs to
+ * be rebuilt when the layers are modified. As all instances of the same library element
+ * look the same, the cache is shared by all of them (see #getSharedCache()).
+ *
+ * @warning The library element must not be modified while a cache of it exists.
+ */
+class PrimitivePathCache final
+{
+    public:
+
+        // Types
+        struct Group_t {
+            int layerId;
+            Length lineWidth;
+            bool isFilled;
+            bool isGrabArea;
+            QPainterPath path;  ///< all primitives of the group [pixels]
+        };
+
+
+        // Constructors / Destructor
+        PrimitivePathCache() noexcept;
+        PrimitivePathCache(const PrimitivePathCache& other) = delete;
+        ~PrimitivePathCache() noexcept;
+
+        // Getters
+        const QList<Group_t>& getGroups() const noexcept {return mGroups;}
+
+        // General Methods
+        void addPolygon(const Polygon& polygon) noexcept;
+        void addEllipse(const Ellipse& ellipse) noexcept;
+
+        // Operator Overloadings
+        PrimitivePathCache& operator=(const PrimitivePathCache& rhs) = delete;
+
+
+        // Static Methods
+
+        /**
+         * @brief Get the cache of a library element (which is built on the first call)
+         *
+         * The cache exists as long as at least one returned pointer exists.
+         *
+         * @param element   A library element with the methods getPolygonCount(),
+         *                  getPolygon(), getEllipseCount() and getEllipse()
+         */
+        template <typename T>
+        static QSharedPointer<const PrimitivePathCache> getSharedCache(const T& element) noexcept
+        {
+            QSharedPointer<const PrimitivePathCache> cache = findSharedCache(&element);
+            if (!cache) {
+                PrimitivePathCache* newCache = new PrimitivePathCache();
+                for (int i = 0; i < element.getPolygonCount(); i++) {
+                    newCache->addPolygon(*element.getPolygon(i));
+                }
+                for (int i = 0; i < element.getEllipseCount(); i++) {
+                    newCache->addEllipse(*element.getEllipse(i));
+                }
+                cache = addSharedCache(&element, newCache);
+            }
+            return cache;
+        }
+
+
+    private:
+
+        // Private Methods
+        void addPath(int layerId, const Length& lineWidth, bool isFilled, bool isGrabArea,
+                     const QPainterPath& path) noexcept;
+        static QSharedPointer<const PrimitivePathCache> findSharedCache(const void* key) noexcept;
+        static QSharedPointer<const PrimitivePathCache> addSharedCache(const void* key,
+                                                                       PrimitivePathCache* cache) noexcept;
+
+
+        // Attributes
+        QList<Group_t> mGroups;
+
+        /// @brief All existing shared caches (the keys are the library elements)
+        static QHash<const void*, QWeakPointer<const PrimitivePathCache>> sSharedCaches;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_PRIMITIVEPATHCACHE_H
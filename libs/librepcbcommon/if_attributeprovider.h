@@ -53,11 +53,16 @@ namespace librepcb {
  * and should return the name of the component instance (like "U123") when the attribute
  * "${CMP::NAME}" was requested.
  *
+ * For texts which need to be updated often, use #AttributeTextTemplate instead of
+ * #replaceVariablesWithAttributes() to avoid parsing the text again and again.
+ *
  * @author ubruhin
  * @date 2015-01-10
  */
 class IF_AttributeProvider
 {
+        friend class AttributeTextTemplate; // uses searchVariableInText()
+
     public:
 
         // Constructors / Destructor
@@ -117,8 +122,11 @@ class IF_AttributeProvider
          * All derived classes must emit this signal when some attributes have changed
          * their values (only attributes which can be fetched with #getAttributeValue(),
          * inclusive all attributes from all "parent" classes).
+         *
+         * @param key   The key (without namespace) of the changed attribute if only a
+         *              single attribute has changed, otherwise an empty string
          */
-        virtual void attributesChanged() = 0;
+        virtual void attributesChanged(const QString& key = QString()) = 0;
 
 
     private:
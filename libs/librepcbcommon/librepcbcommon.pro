@@ -13,7 +13,7 @@ GENERATED_DIR = ../../generated
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml opengl network
+QT += core widgets xml opengl network concurrent
 
 CONFIG += staticlib
 
@@ -35,12 +35,14 @@ HEADERS += \
     fileio/smartfile.h \
     fileio/smarttextfile.h \
     fileio/smartxmlfile.h \
+    fileio/smartxmlfilewriter.h \
     fileio/xmldomdocument.h \
     fileio/xmldomelement.h \
     graphics/graphicsitem.h \
     graphics/graphicsscene.h \
     graphics/graphicsview.h \
     graphics/if_graphicsvieweventhandler.h \
+    graphics/primitivepathcache.h \
     units/all_length_units.h \
     units/angle.h \
     units/length.h \
@@ -52,6 +54,7 @@ HEADERS += \
     exceptions.h \
     gridproperties.h \
     if_attributeprovider.h \
+    attributetexttemplate.h \
     schematiclayer.h \
     systeminfo.h \
     undocommand.h \
@@ -68,6 +71,8 @@ HEADERS += \
     undocommandgroup.h \
     scopeguard.h \
     scopeguardlist.h \
+    disjointset.h \
+    batchedchanges.h \
     boarddesignrules.h \
     dialogs/boarddesignrulesdialog.h \
     cam/gerbergenerator.h \
@@ -89,11 +94,13 @@ SOURCES += \
     fileio/smartfile.cpp \
     fileio/smarttextfile.cpp \
     fileio/smartxmlfile.cpp \
+    fileio/smartxmlfilewriter.cpp \
     fileio/xmldomdocument.cpp \
     fileio/xmldomelement.cpp \
     graphics/graphicsitem.cpp \
     graphics/graphicsscene.cpp \
     graphics/graphicsview.cpp \
+    graphics/primitivepathcache.cpp \
     units/angle.cpp \
     units/length.cpp \
     units/lengthunit.cpp \
@@ -104,6 +111,7 @@ SOURCES += \
     exceptions.cpp \
     gridproperties.cpp \
     if_attributeprovider.cpp \
+    attributetexttemplate.cpp \
     schematiclayer.cpp \
     systeminfo.cpp \
     undocommand.cpp \
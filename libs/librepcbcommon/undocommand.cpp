@@ -42,6 +42,16 @@ UndoCommand::~UndoCommand() noexcept
     Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommand::getEstimatedMemorySize() const noexcept
+{
+    // the size of a typical derived class (some references and old/new values) plus text
+    return 128 + mText.capacity() * sizeof(QChar);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -81,6 +81,16 @@ class UndoCommand
          */
         bool isCurrentlyExecuted() const noexcept {return mRedoCount > mUndoCount;}
 
+        /**
+         * @brief Get the estimated amount of memory used by this command (in bytes)
+         *
+         * This is used by the #UndoStack to limit its memory usage. The default
+         * implementation only returns a rough estimation for small commands, so commands
+         * which hold larger data (for example child commands or copies of whole items)
+         * should override this method.
+         */
+        virtual qint64 getEstimatedMemorySize() const noexcept;
+
 
         // General Methods
 
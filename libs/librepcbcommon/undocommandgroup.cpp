@@ -46,6 +46,19 @@ UndoCommandGroup::~UndoCommandGroup() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommandGroup::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    foreach (const UndoCommand* cmd, mChilds) {
+        size += cmd->getEstimatedMemorySize();
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
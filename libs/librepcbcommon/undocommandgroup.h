@@ -57,6 +57,9 @@ class UndoCommandGroup : public UndoCommand
         // Getters
         int getChildCount() const noexcept {return mChilds.count();}
 
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        virtual qint64 getEstimatedMemorySize() const noexcept override;
+
         // General Methods
 
         /**
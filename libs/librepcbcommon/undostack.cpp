@@ -25,6 +25,7 @@
 #include "undostack.h"
 #include "undocommand.h"
 #include "undocommandgroup.h"
+#include "scopeguard.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -36,7 +37,8 @@ namespace librepcb {
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr),
+    mMaxCommandCount(0), mMaxMemorySize(0)
 {
 }
 
@@ -98,6 +100,13 @@ void UndoStack::setClean() noexcept
     emit cleanChanged(true);
 }
 
+void UndoStack::setLimits(int maxCount, qint64 maxMemorySize) noexcept
+{
+    mMaxCommandCount = qMax(maxCount, 0);
+    mMaxMemorySize = qMax(maxMemorySize, qint64(0));
+    trimCommands();
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -112,6 +121,9 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) throw (Exception)
                            "at the moment. Please finish that command to continue."));
     }
 
+    emit transactionStarted();
+    auto transactionSg = scopeGuard([this](){emit transactionFinished();});
+
     bool commandHasDoneSomething = cmd->execute(); // can throw
 
     if (commandHasDoneSomething || forceKeepCmd) {
@@ -137,6 +149,9 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) throw (Exception)
         emit canUndoChanged(true);
         emit canRedoChanged(false);
         emit cleanChanged(false);
+
+        // delete the oldest commands if the stack has become too large
+        trimCommands();
     } else {
         // the command has done nothing, so we will just discard it
         cmd->undo(); // only to be sure the command has executed nothing...
@@ -150,10 +165,15 @@ void UndoStack::beginCmdGroup(const QString& text) throw (Exception)
                            "at the moment. Please finish that command to continue."));
     }
 
+    // the transaction is finished in commitCmdGroup() or abortCmdGroup()
+    emit transactionStarted();
+    auto transactionSg = scopeGuard([this](){emit transactionFinished();});
+
     UndoCommandGroup* cmd = new UndoCommandGroup(text);
     execCmd(cmd, true); // throws an exception on error; emits all signals
     Q_ASSERT(mCommands.last() == cmd);
     mActiveCommandGroup = cmd;
+    transactionSg.dismiss();
 
     // emit signals
     emit canUndoChanged(false);
@@ -193,7 +213,11 @@ void UndoStack::commitCmdGroup() throw (Exception)
     // currently active command group
     mActiveCommandGroup = nullptr;
 
+    // the group has grown since it was pushed, so check the limits again
+    trimCommands();
+
     // emit signals
+    emit transactionFinished();
     emit canUndoChanged(canUndo());
     emit commandGroupEnded();
 }
@@ -207,23 +231,28 @@ void UndoStack::abortCmdGroup() throw (Exception)
     Q_ASSERT(mActiveCommandGroup);
     Q_ASSERT(mCommands.last() == mActiveCommandGroup);
 
+    // The transaction was started in beginCmdGroup(), so it must be finished in any case.
+    // The aborted command group is removed from the stack even if undoing it fails,
+    // otherwise it would stay active (and the transaction open) forever.
+    auto signalsSg = scopeGuard([this](){
+        emit transactionFinished();
+        emit undoTextChanged(getUndoText());
+        emit redoTextChanged(tr("Redo"));
+        emit canUndoChanged(canUndo());
+        emit canRedoChanged(false);
+        emit cleanChanged(isClean());
+        emit commandGroupAborted(); // this is important!
+    });
+    QScopedPointer<UndoCommand> group(mCommands.takeLast()); // deleted when leaving scope
+    mActiveCommandGroup = nullptr;
+    mCurrentIndex--;
+
     try {
-        mActiveCommandGroup->undo(); // can throw (but should usually not)
-        mActiveCommandGroup = nullptr;
-        mCurrentIndex--;
-        delete mCommands.takeLast(); // delete and remove the aborted command group from the stack
+        group->undo(); // can throw (but should usually not)
     } catch (Exception& e) {
         qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getUserMsg();
         throw;
     }
-
-    // emit signals
-    emit undoTextChanged(getUndoText());
-    emit redoTextChanged(tr("Redo"));
-    emit canUndoChanged(canUndo());
-    emit canRedoChanged(false);
-    emit cleanChanged(isClean());
-    emit commandGroupAborted(); // this is important!
 }
 
 void UndoStack::undo() throw (Exception)
@@ -232,6 +261,9 @@ void UndoStack::undo() throw (Exception)
         return; // if a command group is active, undo() is not allowed
     }
 
+    emit transactionStarted();
+    auto transactionSg = scopeGuard([this](){emit transactionFinished();});
+
     try {
         mCommands[mCurrentIndex-1]->undo(); // can throw (but should usually not)
         mCurrentIndex--;
@@ -254,6 +286,9 @@ void UndoStack::redo() throw (Exception)
         return;
     }
 
+    emit transactionStarted();
+    auto transactionSg = scopeGuard([this](){emit transactionFinished();});
+
     try {
         mCommands[mCurrentIndex]->redo(); // can throw (but should usually not)
         mCurrentIndex++;
@@ -301,6 +336,46 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UndoStack::trimCommands() noexcept
+{
+    if ((mMaxCommandCount <= 0) && (mMaxMemorySize <= 0)) {
+        return;
+    }
+
+    // walk from the top of the stack to the bottom and determine the oldest commands
+    // which do no longer fit into the limits (the redoable commands and the command to
+    // undo next are always kept)
+    qint64 memorySize = 0;
+    int keepFromIndex = 0;
+    for (int i = mCommands.count() - 1; i >= 0; --i) {
+        memorySize += mCommands.at(i)->getEstimatedMemorySize();
+        bool countExceeded = (mMaxCommandCount > 0) && (mCommands.count() - i > mMaxCommandCount);
+        bool memoryExceeded = (mMaxMemorySize > 0) && (memorySize > mMaxMemorySize);
+        if ((i < mCurrentIndex - 1) && (countExceeded || memoryExceeded)) {
+            keepFromIndex = i + 1;
+            break;
+        }
+    }
+    if (keepFromIndex <= 0) {
+        return;
+    }
+    Q_ASSERT(keepFromIndex < mCurrentIndex);
+    Q_ASSERT(!mActiveCommandGroup || (mCommands.indexOf(mActiveCommandGroup) >= keepFromIndex));
+
+    // delete the oldest commands from bottom to top
+    for (int i = 0; i < keepFromIndex; ++i) {
+        delete mCommands.takeFirst();
+    }
+
+    // shift the indices; if the clean state was removed, it can never be reached again
+    mCurrentIndex -= keepFromIndex;
+    mCleanIndex = (mCleanIndex >= keepFromIndex) ? (mCleanIndex - keepFromIndex) : -1;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -59,6 +59,10 @@ class UndoCommandGroup;
  *  - <b>Added support for exclusive macro command creation:</b> @todo Don't sure if this
  *    is a good way, we need some tests first... If the tests are successful, we should
  *    complete this documentation (explain how this feature works).
+ *  - <b>Limits with count and memory budget:</b> Similar to QUndoStack#setUndoLimit(),
+ *    but the oldest commands are also removed if the estimated memory usage of all
+ *    commands (see UndoCommand#getEstimatedMemorySize()) exceeds the limit. See
+ *    #setLimits() for details.
  *
  * @see #UndoCommand, #UndoCommandGroup
  *
@@ -140,6 +144,19 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Set the maximum count and memory usage of the commands in the stack
+         *
+         * If one of the limits is exceeded, the oldest commands are deleted (making
+         * undoing them impossible). The command on top of the stack (the one which would
+         * be undone next) and all redoable commands are never deleted, even if they
+         * exceed the limits.
+         *
+         * @param maxCount      Maximum count of commands (0 = unlimited)
+         * @param maxMemorySize Maximum estimated memory usage in bytes (0 = unlimited)
+         */
+        void setLimits(int maxCount, qint64 maxMemorySize) noexcept;
+
 
         // General Methods
 
@@ -201,6 +218,9 @@ class UndoStack final : public QObject
         /**
          * @brief End the currently active command group and revert the changes
          *
+         * The command group is removed from the stack (and the transaction is finished)
+         * even if reverting the changes fails.
+         *
          * @throw Exception This method throws an exception if there is no command group
          *                  active at the moment (#isCommandGroupActive()) or if an error
          *                  occurs.
@@ -247,9 +267,40 @@ class UndoStack final : public QObject
         void commandGroupEnded();
         void commandGroupAborted();
 
+        /**
+         * @brief This signal is emitted before the stack starts modifying the document
+         *
+         * This is the case when executing, undoing or redoing a command and when a command
+         * group is started. Every #transactionStarted() signal is followed by exactly one
+         * #transactionFinished() signal (also in case of an error), which is emitted
+         * after the command was executed/undone/redone or the command group was committed
+         * or aborted. The signals may be nested.
+         *
+         * This allows to defer expensive updates of the document (e.g. recalculating the
+         * ERC messages) until all changes of a command are done.
+         */
+        void transactionStarted();
+
+        /**
+         * @brief This signal is emitted after the stack has modified the document
+         *
+         * @see #transactionStarted()
+         */
+        void transactionFinished();
+
 
     private:
 
+        // Private Methods
+
+        /**
+         * @brief Delete the oldest commands which exceed the limits (see #setLimits())
+         */
+        void trimCommands() noexcept;
+
+
+        // Attributes
+
         /**
          * @brief This list holds all commands of the undo stack
          *
@@ -279,6 +330,9 @@ class UndoStack final : public QObject
          * or #abortCmdGroup(). Otherwise, the variable contains the nullptr.
          */
         UndoCommandGroup* mActiveCommandGroup;
+
+        int mMaxCommandCount;   ///< @brief Maximum count of commands (0 = unlimited)
+        qint64 mMaxMemorySize;  ///< @brief Maximum memory usage in bytes (0 = unlimited)
 };
 
 /*****************************************************************************************
@@ -28,18 +28,60 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QString Uuid::toStr() const noexcept
+{
+    if (isNull()) return QString();
+
+    static const char hexDigits[] = "0123456789abcdef";
+    QString str(36, QChar('-'));
+    QChar* data = str.data();
+    int pos = 0;
+    for (int i = 0; i < 32; i++)
+    {
+        if ((pos == 8) || (pos == 13) || (pos == 18) || (pos == 23)) pos++; // skip dashes
+        quint64 part = (i < 16) ? mHigh : mLow;
+        int shift = 60 - 4 * (i % 16);
+        data[pos++] = QChar(hexDigits[(part >> shift) & 0xF]);
+    }
+    return str;
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
 
 bool Uuid::setUuid(const QString& uuid) noexcept
 {
-    QUuid quuid(uuid);
-    if (uuid.length() != 36)                return false; // do NOT accept '{' and '}'
-    if (quuid.isNull())                     return false;
-    if (quuid.variant() != QUuid::DCE)      return false;
-    if (quuid.version() != QUuid::Random)   return false;
-    mUuid = uuid;
+    // format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx (do NOT accept '{' and '}')
+    if (uuid.length() != 36) return false;
+    quint64 high = 0;
+    quint64 low = 0;
+    int digits = 0;
+    for (int pos = 0; pos < 36; pos++)
+    {
+        ushort c = uuid.at(pos).unicode();
+        if ((pos == 8) || (pos == 13) || (pos == 18) || (pos == 23))
+        {
+            if (c != '-') return false;
+            continue;
+        }
+        int value = hexDigitToInt(c);
+        if (value < 0) return false;
+        if (digits < 16)
+            high = (high << 4) | value;
+        else
+            low = (low << 4) | value;
+        digits++;
+    }
+    if ((high == 0) && (low == 0))  return false; // NULL UUID
+    if ((low >> 62) != 0x2)         return false; // variant must be DCE (binary 10x)
+    if (((high >> 12) & 0xF) != 4)  return false; // version must be 4 (random)
+    mHigh = high;
+    mLow = low;
     return true;
 }
 
@@ -49,44 +91,45 @@ bool Uuid::setUuid(const QString& uuid) noexcept
 
 Uuid& Uuid::operator=(const Uuid& rhs) noexcept
 {
-    mUuid = rhs.mUuid;
+    mHigh = rhs.mHigh;
+    mLow = rhs.mLow;
     return *this;
 }
 
 bool Uuid::operator==(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid == rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh == rhs.mHigh) && (mLow == rhs.mLow));
 }
 
 bool Uuid::operator!=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid != rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh != rhs.mHigh) || (mLow != rhs.mLow));
 }
 
 bool Uuid::operator<(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid < rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh != rhs.mHigh) ? (mHigh < rhs.mHigh) : (mLow < rhs.mLow));
 }
 
 bool Uuid::operator>(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid > rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh != rhs.mHigh) ? (mHigh > rhs.mHigh) : (mLow > rhs.mLow));
 }
 
 bool Uuid::operator<=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid <= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh != rhs.mHigh) ? (mHigh < rhs.mHigh) : (mLow <= rhs.mLow));
 }
 
 bool Uuid::operator>=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid >= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHigh != rhs.mHigh) ? (mHigh > rhs.mHigh) : (mLow >= rhs.mLow));
 }
 
 /*****************************************************************************************
@@ -95,12 +138,29 @@ bool Uuid::operator>=(const Uuid& rhs) const noexcept
 
 Uuid Uuid::createRandom() noexcept
 {
-    QString str = QUuid::createUuid().toString().remove("{").remove("}");
-    Uuid uuid(str);
-    Q_ASSERT(uuid.isNull() == false); // TODO: check if this works on windows
+    QUuid quuid = QUuid::createUuid();
+    Q_ASSERT(quuid.variant() == QUuid::DCE);
+    Q_ASSERT(quuid.version() == QUuid::Random); // TODO: check if this works on windows
+    Uuid uuid;
+    uuid.mHigh = (quint64(quuid.data1) << 32) | (quint64(quuid.data2) << 16) | quuid.data3;
+    for (int i = 0; i < 8; i++)
+        uuid.mLow = (uuid.mLow << 8) | quuid.data4[i];
+    Q_ASSERT(uuid.isNull() == false);
     return uuid;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+int Uuid::hexDigitToInt(ushort c) noexcept
+{
+    if ((c >= '0') && (c <= '9')) return c - '0';
+    if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+    if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+    return -1;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
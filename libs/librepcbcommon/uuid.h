@@ -37,11 +37,14 @@ namespace librepcb {
 /**
  * @brief The Uuid class is a replacement for QUuid to get UUID strings without {} braces
  *
+ * The UUID is stored as a 128-bit binary value (two 64-bit integers) to make comparing,
+ * hashing and copying cheap (UUIDs are used as keys in a lot of maps). The string
+ * representation is only created on demand with #toStr().
+ *
  * @author ubruhin
  * @date 2015-09-29
  *
  * @todo Check if this class works properly on all operating systems
- * @todo Add unit tests
  */
 class Uuid final
 {
@@ -52,21 +55,21 @@ class Uuid final
         /**
          * @brief Default constructor (creates a NULL #Uuid object)
          */
-        Uuid() noexcept : mUuid() {}
+        Uuid() noexcept : mHigh(0), mLow(0) {}
 
         /**
          * @brief Constructor which creates a #Uuid object from a string
          *
          * @param uuid      The uuid as a string (without braces)
          */
-        explicit Uuid(const QString& uuid) noexcept : mUuid() {setUuid(uuid);}
+        explicit Uuid(const QString& uuid) noexcept : mHigh(0), mLow(0) {setUuid(uuid);}
 
         /**
          * @brief Copy constructor
          *
          * @param other     Another #Uuid object
          */
-        Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+        Uuid(const Uuid& other) noexcept : mHigh(other.mHigh), mLow(other.mLow) {}
 
         /**
          * Destructor
@@ -81,14 +84,14 @@ class Uuid final
          *
          * @return true if NULL/invalid UUID, false if valid UUID
          */
-        bool isNull() const noexcept {return mUuid.isEmpty();}
+        bool isNull() const noexcept {return (mHigh == 0) && (mLow == 0);}
 
         /**
-         * @brief Get the UUID as a string (without braces)
+         * @brief Get the UUID as a string (without braces, lowercase)
          *
-         * @return The UUID as a string
+         * @return The UUID as a string (empty string if #isNull())
          */
-        QString toStr() const noexcept {return mUuid;}
+        QString toStr() const noexcept;
 
 
         // Setters
@@ -133,8 +136,15 @@ class Uuid final
 
     private:
 
+        // Private Methods
+        static int hexDigitToInt(ushort c) noexcept;
+
         // Private Attributes
-        QString mUuid;
+        quint64 mHigh;  ///< the first 8 bytes of the UUID (big endian), 0 if NULL
+        quint64 mLow;   ///< the last 8 bytes of the UUID (big endian), 0 if NULL
+
+        // Friends
+        friend uint qHash(const Uuid& key, uint seed);
 };
 
 /*****************************************************************************************
@@ -143,7 +153,7 @@ class Uuid final
 
 inline uint qHash(const Uuid& key, uint seed)
 {
-    return qHash(key.toStr(), seed);
+    return qHash(key.mHigh ^ key.mLow, seed);
 }
 
 inline QDataStream& operator<<(QDataStream& stream, const Uuid& uuid)
@@ -27,6 +27,8 @@
 #include <librepcbcommon/fileio/smartxmlfile.h>
 #include <librepcbcommon/fileio/xmldomdocument.h>
 #include <librepcbcommon/fileio/xmldomelement.h>
+#include <librepcbcommon/scopeguard.h>
+#include <librepcbcommon/version.h>
 #include "cat/componentcategory.h"
 #include "cat/packagecategory.h"
 #include "sym/symbol.h"
@@ -42,34 +44,31 @@
 namespace librepcb {
 namespace library{
 
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+// increment this number every time the database layout changes!
+const int Library::sDatabaseVersion = 2;
+
+// the *_tr tables of these element tables are indexed for the full-text search
+const QStringList Library::sSearchableTables = QStringList() << "components" << "devices";
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 Library::Library(const FilePath& libDirPath, const FilePath& cacheFilePath) throw (Exception):
-    QObject(0), mLibPath(libDirPath), mLibFilePath(cacheFilePath)
+    QObject(0), mLibPath(libDirPath), mLibFilePath(cacheFilePath), mRescanCancelRequested(0)
 {
     // select and open library cache sqlite database
-    mLibDatabase = QSqlDatabase::addDatabase("QSQLITE", mLibFilePath.toNative());
-    mLibDatabase.setDatabaseName(mLibFilePath.toNative());
-    mLibDatabase.setConnectOptions("foreign_keys = ON");
-
-    // check if database is valid
-    if ( ! mLibDatabase.isValid())
-    {
-        throw RuntimeError(__FILE__, __LINE__, mLibFilePath.toStr(),
-            QString(tr("Invalid library file: \"%1\"")).arg(mLibFilePath.toNative()));
-    }
-
-    if ( ! mLibDatabase.open())
-    {
-        throw RuntimeError(__FILE__, __LINE__, mLibFilePath.toStr(),
-            QString(tr("Could not open library file: \"%1\"")).arg(mLibFilePath.toNative()));
-    }
+    mLibDatabase = openDatabase(mLibFilePath.toNative());
 }
 
 Library::~Library()
 {
+    cancelRescan();
+    mRescanFuture.waitForFinished();
     mLibDatabase.close();
 }
 
@@ -194,6 +193,12 @@ void Library::getPackageMetadata(const FilePath& pkgDir, QString* nameEn) const
     }
 }
 
+QHash<Uuid, Library::ElementSummary> Library::getComponentSummaries(
+    const QList<Uuid>& uuids, const QStringList& localeOrder) const throw (Exception)
+{
+    return getElementSummaries("components", "component_id", uuids, localeOrder);
+}
+
 /*****************************************************************************************
  *  Getters: Special
  ****************************************************************************************/
@@ -233,165 +238,388 @@ QSet<Uuid> Library::getDevicesOfComponent(const Uuid& component) const throw (Ex
     return elements;
 }
 
+/*****************************************************************************************
+ *  Search
+ ****************************************************************************************/
+
+QList<Uuid> Library::searchComponents(const QString& keyword, const QStringList& localeOrder,
+                                      int limit, int offset) const throw (Exception)
+{
+    return searchElements("components", "component_id", keyword, localeOrder, limit, offset);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 int Library::rescan() throw (Exception)
 {
-    clearDatabaseAndCreateTables();
+    QMutexLocker locker(&mRescanMutex); // only one rescan at the same time
+    emit rescanStarted();
 
-    int count = 0;
-    QMultiMap<QString, FilePath> dirs = getAllElementDirectories();
-    count += addCategoriesToDb<ComponentCategory>(  dirs.values("cmpcat"),  "component_categories", "cat_id");
-    count += addCategoriesToDb<PackageCategory>(    dirs.values("pkgcat"),  "package_categories",   "cat_id");
-    count += addElementsToDb<Symbol>(               dirs.values("sym"),     "symbols",              "symbol_id");
-    count += addElementsToDb<SpiceModel>(           dirs.values("spcmdl"),  "spice_models",         "model_id");
-    count += addElementsToDb<Package>(              dirs.values("pkg"),     "packages",             "package_id");
-    count += addElementsToDb<Component>(            dirs.values("cmp"),     "components",           "component_id");
-    count += addDevicesToDb(                        dirs.values("dev"),     "devices",              "device_id");
+    try
+    {
+        // Use a separate database connection for writing, so the library can still be
+        // queried (and returns the previous state) until the transaction is committed.
+        QString connectionName = mLibFilePath.toNative() % "_rescan";
+        auto removeDbSg = scopeGuard([&](){QSqlDatabase::removeDatabase(connectionName);});
+        int count = 0;
+        bool modified = false;
+        {
+            QSqlDatabase db = openDatabase(connectionName);
+            auto closeDbSg = scopeGuard([&](){db.close();});
+            count = rescanDatabase(db, modified);
+        }
+        mRescanCancelRequested.store(0);
+        if (modified) {
+            // the search indices may have been (re)created together with the database
+            {
+                QMutexLocker searchIndexLocker(&mSearchIndexMutex);
+                mSearchIndexCache.clear();
+            }
+            emit elementsModified();
+        }
+        emit rescanFinished(count);
+        return count;
+    }
+    catch (const UserCanceled&)
+    {
+        mRescanCancelRequested.store(0);
+        emit rescanCanceled();
+        throw;
+    }
+    catch (const Exception& e)
+    {
+        mRescanCancelRequested.store(0);
+        emit rescanFailed(e.getUserMsg());
+        throw;
+    }
+}
 
-    return count;
+void Library::startRescan() noexcept
+{
+    if (mRescanFuture.isRunning()) return; // already running
+    mRescanFuture = QtConcurrent::run([this]() -> int {
+        try {
+            return rescan();
+        } catch (const Exception&) {
+            return -1; // already reported with the signal rescanCanceled() or rescanFailed()
+        }
+    });
+}
+
+void Library::cancelRescan() noexcept
+{
+    if (mRescanFuture.isRunning()) mRescanCancelRequested.store(1);
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-template <typename ElementType>
-int Library::addCategoriesToDb(const QList<FilePath>& dirs, const QString& tablename,
-                               const QString& id_rowname) throw (Exception)
+struct Library::ElementMetadata
 {
-    int count = 0;
-    foreach (const FilePath& filepath, dirs)
+    FilePath filepath;                  ///< the element directory
+    QString fingerprint;                ///< see #getDirectoryFingerprint()
+    QString uuid;
+    QString version;
+    QStringList locales;
+    QMap<QString, QString> names;
+    QMap<QString, QString> descriptions;
+    QMap<QString, QString> keywords;
+    QList<Uuid> categories;
+    QVariantMap columns;                ///< additional, table specific columns
+};
+
+int Library::rescanDatabase(QSqlDatabase& db, bool& modified) throw (Exception)
+{
+    // write all changes within one transaction (much faster and atomic)
+    if (!db.transaction())
     {
-        ElementType element(filepath, true);
+        throw RuntimeError(__FILE__, __LINE__, db.lastError().text(),
+            QString(tr("Could not start database transaction: %1"))
+            .arg(db.lastError().databaseText()));
+    }
+    auto sg = scopeGuard([&](){db.rollback();});
 
-        QSqlQuery query = prepareQuery(
-            "INSERT INTO " % tablename % " "
-            "(filepath, uuid, version, parent_uuid) VALUES "
-            "(:filepath, :uuid, :version, :parent_uuid)");
-        query.bindValue(":filepath",    filepath.toRelative(mLibPath));
-        query.bindValue(":uuid",        element.getUuid().toStr());
-        query.bindValue(":version",     element.getVersion().toStr());
-        query.bindValue(":parent_uuid", element.getParentUuid().isNull() ? QVariant(QVariant::String) : element.getParentUuid().toStr());
-        int id = execQuery(query, true);
-
-        foreach (const QString& locale, element.getAllAvailableLocales())
+    // (re)create the database only if it doesn't exist yet or has an outdated layout
+    if (getDatabaseVersion(db) != sDatabaseVersion)
+        clearDatabaseAndCreateTables(db);
+
+    // remove modified and deleted elements, and determine which ones need to be parsed
+    QMultiMap<QString, FilePath> dirs = getAllElementDirectories();
+    QList<ElementMetadata> cmpcat = removeModifiedElementsFromDb(db, dirs.values("cmpcat"), "component_categories", "cat_id", false);
+    QList<ElementMetadata> pkgcat = removeModifiedElementsFromDb(db, dirs.values("pkgcat"), "package_categories", "cat_id", false);
+    QList<ElementMetadata> sym = removeModifiedElementsFromDb(db, dirs.values("sym"), "symbols", "symbol_id", true);
+    QList<ElementMetadata> spcmdl = removeModifiedElementsFromDb(db, dirs.values("spcmdl"), "spice_models", "model_id", true);
+    QList<ElementMetadata> pkg = removeModifiedElementsFromDb(db, dirs.values("pkg"), "packages", "package_id", true);
+    QList<ElementMetadata> cmp = removeModifiedElementsFromDb(db, dirs.values("cmp"), "components", "component_id", true);
+    QList<ElementMetadata> dev = removeModifiedElementsFromDb(db, dirs.values("dev"), "devices", "device_id", true);
+
+    // parse all new/modified elements and add them to the database
+    int total = cmpcat.count() + pkgcat.count() + sym.count() + spcmdl.count() +
+                pkg.count() + cmp.count() + dev.count();
+    int processed = 0;
+    addElementsToDb<ComponentCategory>( db, cmpcat, "component_categories", "cat_id",        processed, total);
+    addElementsToDb<PackageCategory>(   db, pkgcat, "package_categories",   "cat_id",        processed, total);
+    addElementsToDb<Symbol>(            db, sym,    "symbols",              "symbol_id",     processed, total);
+    addElementsToDb<SpiceModel>(        db, spcmdl, "spice_models",         "model_id",      processed, total);
+    addElementsToDb<Package>(           db, pkg,    "packages",             "package_id",    processed, total);
+    addElementsToDb<Component>(         db, cmp,    "components",           "component_id",  processed, total);
+    addElementsToDb<Device>(            db, dev,    "devices",              "device_id",     processed, total);
+
+    // the connection was opened for this rescan, so it has modified the database only if
+    // its count of changed rows is not zero
+    QSqlQuery changesQuery = prepareQuery(db, "SELECT total_changes()");
+    execQuery(changesQuery, false);
+    modified = (changesQuery.first()) && (changesQuery.value(0).toInt() > 0);
+
+    if (!db.commit())
+    {
+        throw RuntimeError(__FILE__, __LINE__, db.lastError().text(),
+            QString(tr("Could not commit database transaction: %1"))
+            .arg(db.lastError().databaseText()));
+    }
+    sg.dismiss();
+    return dirs.count();
+}
+
+QList<Library::ElementMetadata> Library::removeModifiedElementsFromDb(QSqlDatabase& db,
+    const QList<FilePath>& dirs, const QString& tablename, const QString& id_rowname,
+    bool hasCategories) throw (Exception)
+{
+    QHash<QString, QPair<int, QString>> existing = getElementFingerprintsFromDb(db, tablename);
+    bool searchIndex = hasSearchIndex(db, tablename);
+    QList<ElementMetadata> modified;
+    foreach (const FilePath& filepath, dirs)
+    {
+        QString relativePath = filepath.toRelative(mLibPath);
+        QString fingerprint = getDirectoryFingerprint(filepath);
+        if (existing.contains(relativePath))
         {
-            QSqlQuery query = prepareQuery(
-                "INSERT INTO " % tablename % "_tr "
-                "(" % id_rowname % ", locale, name, description, keywords) VALUES "
-                "(:element_id, :locale, :name, :description, :keywords)");
-            query.bindValue(":element_id",  id);
-            query.bindValue(":locale",      locale);
-            query.bindValue(":name",        element.getNames().value(locale));
-            query.bindValue(":description", element.getDescriptions().value(locale));
-            query.bindValue(":keywords",    element.getKeywords().value(locale));
-            execQuery(query, false);
+            QPair<int, QString> entry = existing.take(relativePath);
+            if (entry.second == fingerprint) continue; // element not modified
+            removeElementFromDb(db, tablename, id_rowname, entry.first, hasCategories,
+                                searchIndex);
         }
-        count++;
+        ElementMetadata element;
+        element.filepath = filepath;
+        element.fingerprint = fingerprint;
+        modified.append(element);
     }
-    return count;
+
+    // remove all elements which do no longer exist
+    foreach (const auto& entry, existing)
+        removeElementFromDb(db, tablename, id_rowname, entry.first, hasCategories,
+                            searchIndex);
+
+    return modified;
 }
 
 template <typename ElementType>
-int Library::addElementsToDb(const QList<FilePath>& dirs, const QString& tablename,
-                             const QString& id_rowname) throw (Exception)
+void Library::addElementsToDb(QSqlDatabase& db, const QList<ElementMetadata>& elements,
+                              const QString& tablename, const QString& id_rowname,
+                              int& processed, int total) throw (Exception)
 {
-    int count = 0;
-    foreach (const FilePath& filepath, dirs)
+    if (elements.isEmpty()) return;
+
+    // The elements are parsed in chunks on the global thread pool, but written into the
+    // database only by this thread (a database connection must not be shared).
+    const int chunkSize = 256;
+    QSqlQuery query;
+    QSqlQuery trQuery = prepareQuery(db,
+        "INSERT INTO " % tablename % "_tr "
+        "(" % id_rowname % ", locale, name, description, keywords) VALUES "
+        "(:element_id, :locale, :name, :description, :keywords)");
+    QSqlQuery catQuery;
+    if (!std::is_base_of<LibraryCategory, ElementType>::value)
+    {
+        catQuery = prepareQuery(db,
+            "INSERT INTO " % tablename % "_cat "
+            "(" % id_rowname % ", category_uuid) VALUES "
+            "(:element_id, :category_uuid)");
+    }
+    QSqlQuery ftsQuery;
+    if (hasSearchIndex(db, tablename))
     {
-        ElementType element(filepath, true);
+        ftsQuery = prepareQuery(db,
+            "INSERT INTO " % tablename % "_tr_fts "
+            "(rowid, name, description, keywords) VALUES "
+            "(:rowid, :name, :description, :keywords)");
+    }
+    for (int i = 0; i < elements.count(); i += chunkSize)
+    {
+        if (mRescanCancelRequested.load())
+            throw UserCanceled(__FILE__, __LINE__);
 
-        QSqlQuery query = prepareQuery(
-            "INSERT INTO " % tablename % " "
-            "(filepath, uuid, version) VALUES "
-            "(:filepath, :uuid, :version)");
-        query.bindValue(":filepath",    filepath.toRelative(mLibPath));
-        query.bindValue(":uuid",        element.getUuid().toStr());
-        query.bindValue(":version",     element.getVersion().toStr());
-        int id = execQuery(query, true);
-
-        foreach (const QString& locale, element.getAllAvailableLocales())
+        QList<ElementMetadata> chunk = QtConcurrent::blockingMapped<QList<ElementMetadata>>(
+            elements.mid(i, chunkSize), &Library::parseElement<ElementType>);
+
+        foreach (const ElementMetadata& element, chunk)
         {
-            QSqlQuery query = prepareQuery(
-                "INSERT INTO " % tablename % "_tr "
-                "(" % id_rowname % ", locale, name, description, keywords) VALUES "
-                "(:element_id, :locale, :name, :description, :keywords)");
-            query.bindValue(":element_id",  id);
-            query.bindValue(":locale",      locale);
-            query.bindValue(":name",        element.getNames().value(locale));
-            query.bindValue(":description", element.getDescriptions().value(locale));
-            query.bindValue(":keywords",    element.getKeywords().value(locale));
-            execQuery(query, false);
+            if (query.lastQuery().isEmpty())
+            {
+                // the insert query depends on the table specific columns
+                QStringList columns = QStringList() << "filepath" << "fingerprint"
+                                                    << "uuid" << "version";
+                columns.append(element.columns.keys());
+                query = prepareQuery(db,
+                    "INSERT INTO " % tablename % " (" % columns.join(", ") % ") VALUES "
+                    "(:" % columns.join(", :") % ")");
+            }
+            addElementToDb(query, trQuery, catQuery, ftsQuery, element);
         }
 
-        foreach (const Uuid& categoryUuid, element.getCategories())
+        processed += chunk.count();
+        emit rescanProgress((100 * processed) / qMax(total, 1));
+    }
+}
+
+void Library::addElementToDb(QSqlQuery& query, QSqlQuery& trQuery, QSqlQuery& catQuery,
+                             QSqlQuery& ftsQuery, const ElementMetadata& element) const throw (Exception)
+{
+    query.bindValue(":filepath",    element.filepath.toRelative(mLibPath));
+    query.bindValue(":fingerprint", element.fingerprint);
+    query.bindValue(":uuid",        element.uuid);
+    query.bindValue(":version",     element.version);
+    foreach (const QString& column, element.columns.keys())
+        query.bindValue(":" % column, element.columns.value(column));
+    int id = execQuery(query, true);
+
+    foreach (const QString& locale, element.locales)
+    {
+        trQuery.bindValue(":element_id",  id);
+        trQuery.bindValue(":locale",      locale);
+        trQuery.bindValue(":name",        element.names.value(locale));
+        trQuery.bindValue(":description", element.descriptions.value(locale));
+        trQuery.bindValue(":keywords",    element.keywords.value(locale));
+        int trId = execQuery(trQuery, !ftsQuery.lastQuery().isEmpty());
+
+        if (!ftsQuery.lastQuery().isEmpty())
         {
-            Q_ASSERT(!categoryUuid.isNull());
-            QSqlQuery query = prepareQuery(
-                "INSERT INTO " % tablename % "_cat "
-                "(" % id_rowname % ", category_uuid) VALUES "
-                "(:element_id, :category_uuid)");
-            query.bindValue(":element_id",  id);
-            query.bindValue(":category_uuid", categoryUuid.toStr());
-            execQuery(query, false);
+            // the full-text index row has the same rowid as the indexed *_tr row
+            ftsQuery.bindValue(":rowid",       trId);
+            ftsQuery.bindValue(":name",        element.names.value(locale));
+            ftsQuery.bindValue(":description", element.descriptions.value(locale));
+            ftsQuery.bindValue(":keywords",    element.keywords.value(locale));
+            execQuery(ftsQuery, false);
         }
+    }
 
-        count++;
+    foreach (const Uuid& categoryUuid, element.categories)
+    {
+        Q_ASSERT(!categoryUuid.isNull());
+        catQuery.bindValue(":element_id",  id);
+        catQuery.bindValue(":category_uuid", categoryUuid.toStr());
+        execQuery(catQuery, false);
     }
-    return count;
 }
 
-int Library::addDevicesToDb(const QList<FilePath>& dirs, const QString& tablename,
-                            const QString& id_rowname) throw (Exception)
+void Library::removeElementFromDb(QSqlDatabase& db, const QString& tablename,
+                                  const QString& id_rowname, int id, bool hasCategories,
+                                  bool searchIndex) const throw (Exception)
 {
-    int count = 0;
-    foreach (const FilePath& filepath, dirs)
+    if (searchIndex)
     {
-        Device element(filepath, true);
+        // the full-text index does not store the content, so the removed values must be
+        // passed to the special "delete" command to remove them from the index
+        QSqlQuery query = prepareQuery(db,
+            "INSERT INTO " % tablename % "_tr_fts "
+            "(" % tablename % "_tr_fts, rowid, name, description, keywords) "
+            "SELECT 'delete', id, name, description, keywords FROM " % tablename % "_tr "
+            "WHERE " % id_rowname % " = :id");
+        query.bindValue(":id", id);
+        execQuery(query, false);
+    }
 
-        QSqlQuery query = prepareQuery(
-            "INSERT INTO " % tablename % " "
-            "(filepath, uuid, version, component_uuid, package_uuid) VALUES "
-            "(:filepath, :uuid, :version, :component_uuid, :package_uuid)");
-        query.bindValue(":filepath",        filepath.toRelative(mLibPath));
-        query.bindValue(":uuid",            element.getUuid().toStr());
-        query.bindValue(":version",         element.getVersion().toStr());
-        query.bindValue(":component_uuid",  element.getComponentUuid().toStr());
-        query.bindValue(":package_uuid",    element.getPackageUuid().toStr());
-        int id = execQuery(query, true);
-
-        foreach (const QString& locale, element.getAllAvailableLocales())
-        {
-            QSqlQuery query = prepareQuery(
-                "INSERT INTO " % tablename % "_tr "
-                "(" % id_rowname % ", locale, name, description, keywords) VALUES "
-                "(:element_id, :locale, :name, :description, :keywords)");
-            query.bindValue(":element_id",  id);
-            query.bindValue(":locale",      locale);
-            query.bindValue(":name",        element.getNames().value(locale));
-            query.bindValue(":description", element.getDescriptions().value(locale));
-            query.bindValue(":keywords",    element.getKeywords().value(locale));
-            execQuery(query, false);
-        }
+    QStringList tables;
+    tables << (tablename % "_tr");
+    if (hasCategories) tables << (tablename % "_cat");
+    foreach (const QString& table, tables)
+    {
+        QSqlQuery query = prepareQuery(db, "DELETE FROM " % table % " WHERE " % id_rowname % " = :id");
+        query.bindValue(":id", id);
+        execQuery(query, false);
+    }
+    QSqlQuery query = prepareQuery(db, "DELETE FROM " % tablename % " WHERE id = :id");
+    query.bindValue(":id", id);
+    execQuery(query, false);
+}
 
-        foreach (const Uuid& categoryUuid, element.getCategories())
-        {
-            Q_ASSERT(!categoryUuid.isNull());
-            QSqlQuery query = prepareQuery(
-                "INSERT INTO " % tablename % "_cat "
-                "(" % id_rowname % ", category_uuid) VALUES "
-                "(:element_id, :category_uuid)");
-            query.bindValue(":element_id",  id);
-            query.bindValue(":category_uuid", categoryUuid.toStr());
-            execQuery(query, false);
-        }
+QHash<QString, QPair<int, QString>> Library::getElementFingerprintsFromDb(
+        QSqlDatabase& db, const QString& tablename) const throw (Exception)
+{
+    QSqlQuery query = prepareQuery(db, "SELECT id, filepath, fingerprint FROM " % tablename);
+    execQuery(query, false);
 
-        count++;
+    QHash<QString, QPair<int, QString>> elements;
+    while (query.next())
+    {
+        elements.insert(query.value(1).toString(),
+                        qMakePair(query.value(0).toInt(), query.value(2).toString()));
     }
-    return count;
+    return elements;
+}
+
+QString Library::getDirectoryFingerprint(const FilePath& dir) const noexcept
+{
+    // this only needs the file system metadata, no file has to be read
+    QDir root(dir.toStr());
+    QMap<QString, QFileInfo> files; // sorted by relative path to get a stable result
+    QDirIterator it(root.path(), QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        it.next();
+        files.insert(root.relativeFilePath(it.filePath()), it.fileInfo());
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    for (auto i = files.constBegin(); i != files.constEnd(); ++i)
+    {
+        hash.addData(i.key().toUtf8()); // includes the subdirectory of nested files
+        hash.addData(QByteArray::number(i.value().size()));
+        hash.addData(QByteArray::number(i.value().lastModified().toMSecsSinceEpoch()));
+    }
+    return QString(hash.result().toHex());
+}
+
+int Library::getDatabaseVersion(QSqlDatabase& db) const noexcept
+{
+    QSqlQuery query(db);
+    if ((query.prepare("SELECT value_int FROM internal WHERE key = 'version'")) &&
+        (query.exec()) && (query.first()))
+    {
+        return query.value(0).toInt();
+    }
+    return -1; // table "internal" doesn't exist (new or invalid database)
+}
+
+QSqlDatabase Library::openDatabase(const QString& connectionName) const throw (Exception)
+{
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(mLibFilePath.toNative());
+    db.setConnectOptions("foreign_keys = ON");
+
+    // check if database is valid
+    if ( ! db.isValid())
+    {
+        throw RuntimeError(__FILE__, __LINE__, mLibFilePath.toStr(),
+            QString(tr("Invalid library file: \"%1\"")).arg(mLibFilePath.toNative()));
+    }
+
+    if ( ! db.open())
+    {
+        throw RuntimeError(__FILE__, __LINE__, mLibFilePath.toStr(),
+            QString(tr("Could not open library file: \"%1\"")).arg(mLibFilePath.toNative()));
+    }
+
+    // with write-ahead logging, readers are not blocked by a running rescan
+    QSqlQuery query(db);
+    if (!query.exec("PRAGMA journal_mode=WAL"))
+        qWarning() << "Could not enable WAL mode for library database:" << mLibFilePath.toNative();
+
+    return db;
 }
 
 QMultiMap<Version, FilePath> Library::getElementFilePathsFromDb(const QString& tablename,
@@ -474,7 +702,189 @@ QSet<Uuid> Library::getElementsByCategory(const QString& tablename,
     return elements;
 }
 
-void Library::clearDatabaseAndCreateTables() throw (Exception)
+QHash<Uuid, Library::ElementSummary> Library::getElementSummaries(const QString& tablename,
+    const QString& idrowname, const QList<Uuid>& uuids,
+    const QStringList& localeOrder) const throw (Exception)
+{
+    struct Row {
+        ElementSummary summary;
+        Version version;
+        QMap<QString, QString> names;
+        QMap<QString, QString> descriptions;
+    };
+
+    // fetch all versions and translations of the requested elements (in chunks to keep
+    // the SQL statements small)
+    QHash<int, Row> rows;
+    const int chunkSize = 500;
+    for (int i = 0; i < uuids.count(); i += chunkSize)
+    {
+        QList<Uuid> chunk = uuids.mid(i, chunkSize);
+        QStringList placeholders;
+        for (int j = 0; j < chunk.count(); ++j)
+            placeholders.append(QString(":uuid%1").arg(j));
+        QSqlQuery query = prepareQuery(
+            "SELECT " % tablename % ".id, uuid, version, filepath, locale, name, description "
+            "FROM " % tablename % " LEFT JOIN " % tablename % "_tr "
+            "ON " % tablename % ".id=" % tablename % "_tr." % idrowname % " "
+            "WHERE uuid IN (" % placeholders.join(", ") % ")");
+        for (int j = 0; j < chunk.count(); ++j)
+            query.bindValue(placeholders.at(j), chunk.at(j).toStr());
+        execQuery(query, false);
+        while (query.next())
+        {
+            Row& row = rows[query.value(0).toInt()];
+            row.summary.uuid = Uuid(query.value(1).toString());
+            row.version = Version(query.value(2).toString());
+            row.summary.filepath = FilePath::fromRelative(mLibPath, query.value(3).toString());
+            QString locale = query.value(4).toString();
+            if (!locale.isEmpty()) {
+                row.names.insert(locale, query.value(5).toString());
+                row.descriptions.insert(locale, query.value(6).toString());
+            }
+        }
+    }
+
+    // keep only the latest version of each element
+    QHash<Uuid, Version> versions;
+    QHash<Uuid, ElementSummary> summaries;
+    foreach (Row row, rows)
+    {
+        if ((row.summary.uuid.isNull()) || (!row.version.isValid()) ||
+            (!row.summary.filepath.isValid()))
+        {
+            qWarning() << "Invalid element in library:" << tablename << "::"
+                       << row.summary.uuid.toStr();
+            continue;
+        }
+        if (versions.contains(row.summary.uuid) &&
+            (versions.value(row.summary.uuid) >= row.version)) continue;
+        try {
+            row.summary.name = LibraryBaseElement::localeStringFromList(row.names, localeOrder);
+            row.summary.description = LibraryBaseElement::localeStringFromList(row.descriptions, localeOrder);
+        } catch (const Exception&) {
+            // no translation found, leave the strings empty
+        }
+        versions.insert(row.summary.uuid, row.version);
+        summaries.insert(row.summary.uuid, row.summary);
+    }
+    return summaries;
+}
+
+QList<Uuid> Library::searchElements(const QString& tablename, const QString& idrowname,
+    const QString& keyword, const QStringList& localeOrder, int limit, int offset) const throw (Exception)
+{
+    QString match = buildSearchMatchExpression(keyword);
+    if (match.isEmpty()) return QList<Uuid>();
+
+    // matches in preferred locales are ranked first
+    QString localeRank = "CASE " % tablename % "_tr.locale";
+    for (int i = 0; i < localeOrder.count(); ++i)
+        localeRank += QString(" WHEN :locale%1 THEN %1").arg(i);
+    localeRank += QString(" ELSE %1 END").arg(localeOrder.count());
+
+    QSqlQuery query;
+    if (hasSearchIndex(tablename))
+    {
+        // rank matches in names higher than matches in keywords and descriptions
+        query = prepareQuery(
+            "SELECT uuid FROM ("
+                "SELECT " % tablename % ".uuid AS uuid, " % localeRank % " AS locale_rank, "
+                "bm25(" % tablename % "_tr_fts, 10.0, 1.0, 5.0) AS score "
+                "FROM " % tablename % "_tr_fts "
+                "INNER JOIN " % tablename % "_tr ON " % tablename % "_tr.id=" % tablename % "_tr_fts.rowid "
+                "INNER JOIN " % tablename % " ON " % tablename % ".id=" % tablename % "_tr." % idrowname % " "
+                "WHERE " % tablename % "_tr_fts MATCH :match"
+            ") GROUP BY uuid ORDER BY MIN(locale_rank), MIN(score) "
+            "LIMIT :limit OFFSET :offset");
+        query.bindValue(":match", match);
+    }
+    else
+    {
+        // like with the full-text index, every word must match (but anywhere in a column,
+        // and the LIKE wildcards in the user input are matched literally)
+        QStringList words = keyword.split(QRegularExpression("\\s+"), QString::SkipEmptyParts);
+        QStringList conditions;
+        for (int i = 0; i < words.count(); ++i)
+        {
+            QStringList columns;
+            foreach (const QString& column, QStringList() << "name" << "description" << "keywords")
+                columns.append(tablename % "_tr." % column % " LIKE " %
+                               QString(":like%1_").arg(i) % column % " ESCAPE '\\'");
+            conditions.append("(" % columns.join(" OR ") % ")");
+        }
+        query = prepareQuery(
+            "SELECT " % tablename % ".uuid FROM " % tablename % "_tr "
+            "INNER JOIN " % tablename % " ON " % tablename % ".id=" % tablename % "_tr." % idrowname % " "
+            "WHERE " % conditions.join(" AND ") % " "
+            "GROUP BY " % tablename % ".uuid "
+            "ORDER BY MIN(" % localeRank % "), MIN(" % tablename % "_tr.name) "
+            "LIMIT :limit OFFSET :offset");
+        for (int i = 0; i < words.count(); ++i)
+        {
+            QString word = words.at(i);
+            word.replace("\\", "\\\\").replace("%", "\\%").replace("_", "\\_");
+            foreach (const QString& column, QStringList() << "name" << "description" << "keywords")
+                query.bindValue(QString(":like%1_").arg(i) % column, QString("%" % word % "%"));
+        }
+    }
+    for (int i = 0; i < localeOrder.count(); ++i)
+        query.bindValue(QString(":locale%1").arg(i), localeOrder.at(i));
+    query.bindValue(":limit", limit);
+    query.bindValue(":offset", offset);
+    execQuery(query, false);
+
+    QList<Uuid> elements;
+    while (query.next())
+    {
+        QString uuidStr = query.value(0).toString();
+        Uuid uuid(uuidStr);
+        if (!uuid.isNull())
+            elements.append(uuid);
+        else
+            qWarning() << "Invalid element in library:" << tablename << "::" << uuidStr;
+    }
+    return elements;
+}
+
+bool Library::hasSearchIndex(const QSqlDatabase& db, const QString& tablename) const noexcept
+{
+    QSqlQuery query(db);
+    if (!query.prepare("SELECT 1 FROM sqlite_master WHERE name = :name")) return false;
+    query.bindValue(":name", QString(tablename % "_tr_fts"));
+    return (query.exec()) && (query.first());
+}
+
+bool Library::hasSearchIndex(const QString& tablename) const noexcept
+{
+    // the index only changes when the database is recreated by a rescan, so the result
+    // for the connection #mLibDatabase is cached (and cleared after a modifying rescan)
+    QMutexLocker locker(&mSearchIndexMutex);
+    if (!mSearchIndexCache.contains(tablename))
+        mSearchIndexCache.insert(tablename, hasSearchIndex(mLibDatabase, tablename));
+    return mSearchIndexCache.value(tablename);
+}
+
+void Library::createSearchIndices(QSqlDatabase& db) const noexcept
+{
+    // FTS5 is an optional SQLite extension, so errors are not fatal (without the index,
+    // searchElements() falls back to LIKE queries)
+    foreach (const QString& table, sSearchableTables)
+    {
+        QSqlQuery query(db);
+        query.exec(QString("DROP TABLE IF EXISTS %1_tr_fts").arg(table));
+        if (!query.exec(QString("CREATE VIRTUAL TABLE %1_tr_fts USING fts5("
+                                "name, description, keywords, "
+                                "content='%1_tr', content_rowid='id', prefix='2 3', "
+                                "tokenize='unicode61 remove_diacritics 1')").arg(table)))
+        {
+            qWarning() << "Could not create full-text search index for" << table << ":"
+                       << query.lastError().databaseText();
+        }
+    }
+}
+
+void Library::clearDatabaseAndCreateTables(QSqlDatabase& db) throw (Exception)
 {
     QStringList queries;
 
@@ -513,6 +923,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE component_categories ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
                         "`parent_uuid` TEXT"
@@ -533,6 +944,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE package_categories ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
                         "`parent_uuid` TEXT"
@@ -554,6 +966,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE symbols ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL"
                         ")");
@@ -580,6 +993,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE spice_models ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL"
                         ")");
@@ -606,6 +1020,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE packages ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL "
                         ")");
@@ -632,6 +1047,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE components ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL"
                         ")");
@@ -658,6 +1074,7 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
     queries << QString( "CREATE TABLE devices ("
                         "`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`fingerprint` TEXT NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
                         "`component_uuid` TEXT NOT NULL, "
@@ -679,12 +1096,33 @@ void Library::clearDatabaseAndCreateTables() throw (Exception)
                         "UNIQUE(device_id, category_uuid)"
                         ")");
 
+    // indices
+    QStringList elementTables = QStringList() << "component_categories"
+        << "package_categories" << "symbols" << "spice_models" << "packages"
+        << "components" << "devices";
+    foreach (const QString& table, elementTables)
+    {
+        queries << QString("CREATE INDEX %1_uuid_index ON %1 (uuid)").arg(table);
+        if (!table.endsWith("_categories"))
+            queries << QString("CREATE INDEX %1_cat_category_uuid_index ON %1_cat (category_uuid)").arg(table);
+    }
+    queries << QString( "CREATE INDEX component_categories_parent_uuid_index ON component_categories (parent_uuid)");
+    queries << QString( "CREATE INDEX package_categories_parent_uuid_index ON package_categories (parent_uuid)");
+    queries << QString( "CREATE INDEX devices_component_uuid_index ON devices (component_uuid)");
+
+    // database layout version
+    queries << QString( "INSERT INTO internal (key, value_int) VALUES ('version', %1)")
+                        .arg(sDatabaseVersion);
+
     // execute queries
     foreach (const QString& string, queries)
     {
-        QSqlQuery query = prepareQuery(string);
+        QSqlQuery query = prepareQuery(db, string);
         execQuery(query, false);
     }
+
+    // full-text search indices
+    createSearchIndices(db);
 }
 
 QMultiMap<QString, FilePath> Library::getAllElementDirectories() throw (Exception)
@@ -702,7 +1140,12 @@ QMultiMap<QString, FilePath> Library::getAllElementDirectories() throw (Exceptio
 
 QSqlQuery Library::prepareQuery(const QString& query) const throw (Exception)
 {
-    QSqlQuery q(mLibDatabase);
+    return prepareQuery(mLibDatabase, query);
+}
+
+QSqlQuery Library::prepareQuery(const QSqlDatabase& db, const QString& query) const throw (Exception)
+{
+    QSqlQuery q(db);
     if (!q.prepare(query))
     {
         throw RuntimeError(__FILE__, __LINE__, QString("%1: %2, %3").arg(query,
@@ -731,6 +1174,56 @@ int Library::execQuery(QSqlQuery& query, bool checkId) const throw (Exception)
     return id;
 }
 
+/*****************************************************************************************
+ *  Static Private Methods
+ ****************************************************************************************/
+
+template <typename ElementType>
+Library::ElementMetadata Library::parseElement(const ElementMetadata& dir) throw (Exception)
+{
+    ElementType element(dir.filepath, true);
+    ElementMetadata metadata(dir);
+    metadata.uuid = element.getUuid().toStr();
+    metadata.version = element.getVersion().toStr();
+    metadata.locales = element.getAllAvailableLocales();
+    metadata.names = element.getNames();
+    metadata.descriptions = element.getDescriptions();
+    metadata.keywords = element.getKeywords();
+    addTypeSpecificMetadata(element, metadata);
+    return metadata;
+}
+
+void Library::addTypeSpecificMetadata(const LibraryCategory& element,
+                                      ElementMetadata& metadata) noexcept
+{
+    metadata.columns.insert("parent_uuid", element.getParentUuid().isNull() ?
+                            QVariant(QVariant::String) : element.getParentUuid().toStr());
+}
+
+void Library::addTypeSpecificMetadata(const LibraryElement& element,
+                                      ElementMetadata& metadata) noexcept
+{
+    metadata.categories = element.getCategories();
+}
+
+void Library::addTypeSpecificMetadata(const Device& element,
+                                      ElementMetadata& metadata) noexcept
+{
+    addTypeSpecificMetadata(static_cast<const LibraryElement&>(element), metadata);
+    metadata.columns.insert("component_uuid", element.getComponentUuid().toStr());
+    metadata.columns.insert("package_uuid", element.getPackageUuid().toStr());
+}
+
+QString Library::buildSearchMatchExpression(const QString& keyword) noexcept
+{
+    // every word is quoted (so the user input can't contain FTS5 syntax) and matched as
+    // prefix, all words must match (implicit AND)
+    QStringList terms;
+    foreach (QString word, keyword.split(QRegularExpression("\\s+"), QString::SkipEmptyParts))
+        terms.append("\"" % word.replace("\"", "\"\"") % "\"*");
+    return terms.join(" ");
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtSql>
+#include <QtConcurrent>
 #include <librepcbcommon/uuid.h>
 #include <librepcbcommon/exceptions.h>
 #include <librepcbcommon/fileio/filepath.h>
@@ -38,6 +39,8 @@ class Version;
 
 namespace library {
 
+class LibraryElement;
+class LibraryCategory;
 class ComponentCategory;
 class PackageCategory;
 class Symbol;
@@ -53,11 +56,22 @@ class Device;
 /**
  * @brief The Library class
  *
+ * The library elements are indexed in a SQLite database (cache). On #rescan(), only
+ * element directories which were added, modified (detected by a fingerprint of the
+ * directory content metadata) or removed since the last scan are updated in the database.
+ *
+ * The library elements are parsed in parallel on the global thread pool, but only one
+ * thread (the one which runs #rescan()) writes into the database, using its own database
+ * connection. Until the rescan is committed, all other connections (i.e. all getters of
+ * this class) still see the previous state of the database. Use #startRescan() to run
+ * the rescan in the background without blocking the caller.
+ *
+ * The names, descriptions and keywords of components and devices are additionally
+ * indexed in SQLite FTS5 tables (populated during the rescan) which allow fast
+ * full-text searches (see #searchComponents()). If the SQLite
+ * library does not support FTS5, the search falls back to (slow) LIKE queries.
+ *
  * @todo This class needs some refactoring:
- *          - rescan() is very slow
- *          - rescan() does not report its progress
- *          - rescan() blocks the whole application
- *          - rescan() does not really have exception handling
  *          - rescan() searches all XML files instead of element directories
  *              --> error if there are multiple XML files in one element directory
  *          - many other issues...
@@ -68,6 +82,19 @@ class Library final : public QObject
 
     public:
 
+        // Types
+
+        /**
+         * @brief Summary of the latest version of an element (read from the database,
+         *        so no XML file needs to be parsed)
+         */
+        struct ElementSummary {
+            Uuid uuid;
+            FilePath filepath;      ///< the element directory
+            QString name;           ///< in the best available locale
+            QString description;    ///< in the best available locale
+        };
+
         // Constructors / Destructor
 
         /**
@@ -105,6 +132,8 @@ class Library final : public QObject
         void getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid = nullptr,
                                QString* nameEn = nullptr) const throw (Exception);
         void getPackageMetadata(const FilePath& pkgDir, QString* nameEn = nullptr) const throw (Exception);
+        QHash<Uuid, ElementSummary> getComponentSummaries(const QList<Uuid>& uuids,
+                const QStringList& localeOrder) const throw (Exception);
 
         // Getters: Special
         QSet<Uuid> getComponentCategoryChilds(const Uuid& parent) const throw (Exception);
@@ -112,13 +141,72 @@ class Library final : public QObject
         QSet<Uuid> getComponentsByCategory(const Uuid& category) const throw (Exception);
         QSet<Uuid> getDevicesOfComponent(const Uuid& component) const throw (Exception);
 
+        // Search
+
+        /**
+         * @brief Search components by their names, descriptions and keywords
+         *
+         * @param keyword       The search term entered by the user. Every word of it must
+         *                      match (as prefix) a word of the name, description or
+         *                      keywords of an element.
+         * @param localeOrder   Matches in these locales are ranked higher (in this order)
+         * @param limit         Maximum count of results (-1 = unlimited)
+         * @param offset        Count of results to skip (for pagination)
+         *
+         * @return The UUIDs of all matching components, the best match first
+         */
+        QList<Uuid> searchComponents(const QString& keyword, const QStringList& localeOrder,
+                                     int limit = -1, int offset = 0) const throw (Exception);
+
         // General Methods
 
         /**
          * @brief Rescan the whole library directory and update the SQLite database
+         *
+         * Only new, modified and removed elements are updated in the database. All
+         * changes are written in a single transaction, so the database is never left
+         * in an inconsistent state.
+         *
+         * @note    This method blocks until the rescan is finished. It can be called from
+         *          any thread, the database is accessed with a separate connection.
+         *
+         * @return The count of elements in the library
+         *
+         * @throw UserCanceled  If the rescan was canceled with #cancelRescan().
          */
         int rescan() throw (Exception);
 
+        /**
+         * @brief Start #rescan() in a background thread and return immediately
+         *
+         * The progress and the result are reported with the signals #rescanStarted(),
+         * #rescanProgress(), #rescanFinished(), #rescanCanceled() and #rescanFailed().
+         * Every started rescan ends with exactly one of the last three signals.
+         */
+        void startRescan() noexcept;
+
+        /**
+         * @brief Request to cancel a running rescan (all changes are rolled back)
+         */
+        void cancelRescan() noexcept;
+
+        /**
+         * @brief Check whether a background rescan (#startRescan()) is currently running
+         *
+         * @return true if running, false if not
+         */
+        bool isRescanRunning() const noexcept {return mRescanFuture.isRunning();}
+
+
+    signals:
+
+        void rescanStarted();
+        void rescanProgress(int percent);
+        void rescanFinished(int elementCount);
+        void elementsModified(); ///< a rescan has added, modified or removed elements
+        void rescanCanceled(); ///< the rescan was canceled with #cancelRescan()
+        void rescanFailed(const QString& errorMsg);
+
 
     private:
 
@@ -128,31 +216,76 @@ class Library final : public QObject
         Library& operator=(const Library& rhs);
 
 
+        // Types
+        struct ElementMetadata; ///< all data of an element which is stored in the database
+
         // Private Methods
+        int rescanDatabase(QSqlDatabase& db, bool& modified) throw (Exception);
+        QList<ElementMetadata> removeModifiedElementsFromDb(QSqlDatabase& db,
+                                                            const QList<FilePath>& dirs,
+                                                            const QString& tablename,
+                                                            const QString& id_rowname,
+                                                            bool hasCategories) throw (Exception);
         template <typename ElementType>
-        int addCategoriesToDb(const QList<FilePath>& dirs, const QString& tablename,
-                              const QString& id_rowname) throw (Exception);
-        template <typename ElementType>
-        int addElementsToDb(const QList<FilePath>& dirs, const QString& tablename,
-                            const QString& id_rowname) throw (Exception);
-        int addDevicesToDb(const QList<FilePath>& dirs, const QString& tablename,
-                           const QString& id_rowname) throw (Exception);
+        void addElementsToDb(QSqlDatabase& db, const QList<ElementMetadata>& elements,
+                             const QString& tablename, const QString& id_rowname,
+                             int& processed, int total) throw (Exception);
+        void addElementToDb(QSqlQuery& query, QSqlQuery& trQuery, QSqlQuery& catQuery,
+                            QSqlQuery& ftsQuery, const ElementMetadata& element) const throw (Exception);
+        void removeElementFromDb(QSqlDatabase& db, const QString& tablename,
+                                 const QString& id_rowname, int id, bool hasCategories,
+                                 bool searchIndex) const throw (Exception);
+        QHash<QString, QPair<int, QString>> getElementFingerprintsFromDb(
+                QSqlDatabase& db, const QString& tablename) const throw (Exception);
+        QString getDirectoryFingerprint(const FilePath& dir) const noexcept;
+        int getDatabaseVersion(QSqlDatabase& db) const noexcept;
+        QSqlDatabase openDatabase(const QString& connectionName) const throw (Exception);
         QMultiMap<Version, FilePath> getElementFilePathsFromDb(const QString& tablename,
                                                                const Uuid& uuid) const noexcept;
         FilePath getLatestVersionFilePath(const QMultiMap<Version, FilePath>& list) const noexcept;
         QSet<Uuid> getCategoryChilds(const QString& tablename, const Uuid& categoryUuid) const throw (Exception);
         QSet<Uuid> getElementsByCategory(const QString& tablename, const QString& idrowname,
                                           const Uuid& categoryUuid) const throw (Exception);
-        void clearDatabaseAndCreateTables() throw (Exception);
+        QHash<Uuid, ElementSummary> getElementSummaries(const QString& tablename,
+                const QString& idrowname, const QList<Uuid>& uuids,
+                const QStringList& localeOrder) const throw (Exception);
+        QList<Uuid> searchElements(const QString& tablename, const QString& idrowname,
+                                   const QString& keyword, const QStringList& localeOrder,
+                                   int limit, int offset) const throw (Exception);
+        bool hasSearchIndex(const QSqlDatabase& db, const QString& tablename) const noexcept;
+        bool hasSearchIndex(const QString& tablename) const noexcept;
+        void createSearchIndices(QSqlDatabase& db) const noexcept;
+        void clearDatabaseAndCreateTables(QSqlDatabase& db) throw (Exception);
         QMultiMap<QString, FilePath> getAllElementDirectories() throw (Exception);
         QSqlQuery prepareQuery(const QString& query) const throw (Exception);
+        QSqlQuery prepareQuery(const QSqlDatabase& db, const QString& query) const throw (Exception);
         int execQuery(QSqlQuery& query, bool checkId) const throw (Exception);
 
+        // Static Private Methods
+        template <typename ElementType>
+        static ElementMetadata parseElement(const ElementMetadata& dir) throw (Exception);
+        static void addTypeSpecificMetadata(const LibraryCategory& element,
+                                            ElementMetadata& metadata) noexcept;
+        static void addTypeSpecificMetadata(const LibraryElement& element,
+                                            ElementMetadata& metadata) noexcept;
+        static void addTypeSpecificMetadata(const Device& element,
+                                            ElementMetadata& metadata) noexcept;
+        static QString buildSearchMatchExpression(const QString& keyword) noexcept;
+
 
         // Attributes
         FilePath mLibPath; ///< a FilePath object which represents the library directory
         FilePath mLibFilePath; ///< a #FilePath object which represents the library_cache.sqlite file
         QSqlDatabase mLibDatabase; ///< the SQLite database of the file #mLibFilePath
+        QMutex mRescanMutex; ///< to allow only one rescan at the same time
+        QAtomicInt mRescanCancelRequested; ///< 1 if the running rescan should be canceled
+        QFuture<int> mRescanFuture; ///< the background rescan started by #startRescan()
+        mutable QMutex mSearchIndexMutex; ///< protects #mSearchIndexCache
+        mutable QHash<QString, bool> mSearchIndexCache; ///< see #hasSearchIndex(const QString&)
+
+        // Static Variables
+        static const int sDatabaseVersion; ///< the layout version of the database
+        static const QStringList sSearchableTables; ///< tables with a full-text search index
 };
 
 /*****************************************************************************************
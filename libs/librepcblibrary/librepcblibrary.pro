@@ -13,7 +13,7 @@ GENERATED_DIR = ../../generated
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -31,6 +31,7 @@ HEADERS += \
     sym/symbolpinpreviewgraphicsitem.h \
     sym/symbolpreviewgraphicsitem.h \
     library.h \
+    previewthumbnailcache.h \
     librarybaseelement.h \
     libraryelement.h \
     libraryelementattribute.h \
@@ -62,6 +63,7 @@ SOURCES += \
     sym/symbolpinpreviewgraphicsitem.cpp \
     sym/symbolpreviewgraphicsitem.cpp \
     library.cpp \
+    previewthumbnailcache.cpp \
     librarybaseelement.cpp \
     libraryelement.cpp \
     libraryelementattribute.cpp \
@@ -63,6 +63,8 @@ FootprintPadPreviewGraphicsItem::~FootprintPadPreviewGraphicsItem() noexcept
 
 void FootprintPadPreviewGraphicsItem::updateCacheAndRepaint() noexcept
 {
+    prepareGeometryChange();
+
     mShape = mFootprintPad.toQPainterPathPx();
     mBoundingRect = mShape.boundingRect();
 
@@ -82,7 +82,7 @@ class FootprintPreviewGraphicsItem final : public GraphicsItem, public IF_Attrib
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged() {}
+        void attributesChanged(const QString& key = QString()) {Q_UNUSED(key);}
 
 
     private:
@@ -0,0 +1,383 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <librepcbcommon/schematiclayer.h>
+#include <librepcbcommon/boardlayer.h>
+#include <librepcbcommon/if_schematiclayerprovider.h>
+#include <librepcbcommon/if_boardlayerprovider.h>
+#include "previewthumbnailcache.h"
+#include "library.h"
+#include "cmp/component.h"
+#include "cmp/componentsymbolvariant.h"
+#include "cmp/componentsymbolvariantitem.h"
+#include "sym/symbol.h"
+#include "sym/symbolpreviewgraphicsitem.h"
+#include "pkg/package.h"
+#include "pkg/footprint.h"
+#include "pkg/footprintpreviewgraphicsitem.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Class PreviewLayerProvider
+ ****************************************************************************************/
+
+/**
+ * @brief Provides layers with default colors to render thumbnails independent of the
+ *        layers (and colors) of any opened project
+ */
+class PreviewLayerProvider final : public IF_SchematicLayerProvider,
+                                   public IF_BoardLayerProvider
+{
+    public:
+        PreviewLayerProvider() noexcept {}
+        ~PreviewLayerProvider() noexcept
+        {
+            qDeleteAll(mSchematicLayers);   mSchematicLayers.clear();
+            qDeleteAll(mBoardLayers);       mBoardLayers.clear();
+        }
+        SchematicLayer* getSchematicLayer(int id) const noexcept
+        {
+            if (!mSchematicLayers.contains(id)) mSchematicLayers.insert(id, new SchematicLayer(id));
+            return mSchematicLayers.value(id);
+        }
+        BoardLayer* getBoardLayer(int id) const noexcept
+        {
+            if (!mBoardLayers.contains(id)) mBoardLayers.insert(id, new BoardLayer(id));
+            return mBoardLayers.value(id);
+        }
+
+    private:
+        mutable QHash<int, SchematicLayer*> mSchematicLayers;
+        mutable QHash<int, BoardLayer*> mBoardLayers;
+};
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+PreviewThumbnailCache::PreviewThumbnailCache(const Library& library,
+                                             const FilePath& directory) noexcept :
+    QObject(nullptr), mLibrary(library), mDirectory(directory), mMemoryCache(sMemoryCacheSize),
+    mDiskCacheSize(-1), mGeneration(0)
+{
+    if (!mDirectory.mkPath())
+        qWarning() << "Could not create thumbnail cache directory:" << mDirectory.toNative();
+}
+
+PreviewThumbnailCache::~PreviewThumbnailCache() noexcept
+{
+    // the workers must not outlive this object
+    foreach (QFutureWatcher<Renderer>* watcher, mPendingLoads)
+        watcher->waitForFinished();
+    qDeleteAll(mPendingLoads);      mPendingLoads.clear();
+    foreach (QFuture<void> future, mPendingWrites)
+        future.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QPixmap PreviewThumbnailCache::getSymbolVariantThumbnail(const Component& component,
+    const Uuid& symbVarUuid, const QStringList& localeOrder) noexcept
+{
+    QString key = buildKey("symbvar", component, symbVarUuid, localeOrder);
+    QPixmap pixmap;
+    if (findThumbnail(key, pixmap)) return pixmap;
+
+    const ComponentSymbolVariant* symbVar = component.getSymbolVariantByUuid(symbVarUuid);
+    if (!symbVar) return QPixmap();
+
+    // the library database can only be accessed from this thread
+    QList<QPair<Uuid, FilePath>> symbols; // symbol variant item UUID -> symbol directory
+    for (int i = 0; i < symbVar->getItemCount(); i++) {
+        const ComponentSymbolVariantItem* item = symbVar->getItem(i);
+        Q_ASSERT(item); if (!item) continue;
+        try {
+            FilePath symbolFp = mLibrary.getLatestSymbol(item->getSymbolUuid());
+            if (symbolFp.isValid()) symbols.append(qMakePair(item->getUuid(), symbolFp));
+        } catch (const Exception& e) {
+            qWarning() << "Could not get symbol for thumbnail:" << e.getDebugMsg();
+        }
+    }
+
+    FilePath cmpFp = component.getFilePath();
+    QThread* guiThread = thread();
+    startLoading(key, [cmpFp, symbVarUuid, symbols, localeOrder, guiThread]() {
+        return loadSymbolVariant(cmpFp, symbVarUuid, symbols, localeOrder, guiThread);
+    });
+    return QPixmap();
+}
+
+QPixmap PreviewThumbnailCache::getFootprintThumbnail(const Package& package,
+    const Uuid& footprintUuid, const QStringList& localeOrder) noexcept
+{
+    QString key = buildKey("footprint", package, footprintUuid, localeOrder);
+    QPixmap pixmap;
+    if (findThumbnail(key, pixmap)) return pixmap;
+
+    FilePath pkgFp = package.getFilePath();
+    QThread* guiThread = thread();
+    startLoading(key, [pkgFp, footprintUuid, localeOrder, guiThread]() {
+        return loadFootprint(pkgFp, footprintUuid, localeOrder, guiThread);
+    });
+    return QPixmap();
+}
+
+/*****************************************************************************************
+ *  Public Slots
+ ****************************************************************************************/
+
+void PreviewThumbnailCache::clear() noexcept
+{
+    QMutexLocker locker(&mDiskMutex);
+    mGeneration.ref();
+    mMemoryCache.clear();
+    mFailedKeys.clear();
+    QDir dir(mDirectory.toStr());
+    foreach (const QString& filename, dir.entryList(QStringList("*.png"), QDir::Files)) {
+        if (!dir.remove(filename))
+            qWarning() << "Could not remove thumbnail:" << filename;
+    }
+    mDiskCacheSize = -1; // determined again with the next written file
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool PreviewThumbnailCache::findThumbnail(const QString& key, QPixmap& pixmap) noexcept
+{
+    if (const QPixmap* cached = mMemoryCache.object(key)) {
+        pixmap = *cached;
+        return true;
+    }
+    if (pixmap.load(getThumbnailFilePath(key).toStr(), "PNG")) {
+        mMemoryCache.insert(key, new QPixmap(pixmap), pixmap.width() * pixmap.height() * 4 / 1024);
+        return true;
+    }
+    return false;
+}
+
+void PreviewThumbnailCache::startLoading(const QString& key,
+                                         const std::function<Renderer()>& loader) noexcept
+{
+    if (mPendingLoads.contains(key)) return; // already requested
+    if (mFailedKeys.contains(key)) return; // would fail again until the cache is cleared
+
+    QFutureWatcher<Renderer>* watcher = new QFutureWatcher<Renderer>();
+    int generation = mGeneration.load();
+    connect(watcher, &QFutureWatcher<Renderer>::finished, this,
+            [this, watcher, key, generation]() {
+        mPendingLoads.remove(key);
+        watcher->deleteLater();
+        if (generation != mGeneration.load()) {
+            // discarded, but the receivers must request the outdated thumbnail again
+            emit thumbnailReady();
+            return;
+        }
+        Renderer renderer = watcher->result();
+        QImage image;
+        if (renderer) image = renderer(); // the graphics items are rendered in this thread
+        if (image.isNull()) {
+            // invalid element or nothing to render, don't try it again and again
+            mFailedKeys.insert(key);
+            return;
+        }
+        QPixmap* pixmap = new QPixmap(QPixmap::fromImage(image));
+        mMemoryCache.insert(key, pixmap, pixmap->width() * pixmap->height() * 4 / 1024);
+        startWriting(key, image, generation);
+        emit thumbnailReady();
+    });
+    mPendingLoads.insert(key, watcher);
+    watcher->setFuture(QtConcurrent::run(loader));
+}
+
+void PreviewThumbnailCache::startWriting(const QString& key, const QImage& image,
+                                         int generation) noexcept
+{
+    for (auto it = mPendingWrites.begin(); it != mPendingWrites.end();) {
+        if (it->isFinished())
+            it = mPendingWrites.erase(it);
+        else
+            ++it;
+    }
+    mPendingWrites.append(QtConcurrent::run([this, key, image, generation]() {
+        writeThumbnail(key, image, generation);
+    }));
+}
+
+void PreviewThumbnailCache::writeThumbnail(const QString& key, const QImage& image,
+                                           int generation) noexcept
+{
+    // this is called in a worker thread, so only the disk may be accessed here
+    QByteArray png;
+    QBuffer buffer(&png);
+    buffer.open(QIODevice::WriteOnly);
+    if (!image.save(&buffer, "PNG")) return;
+
+    QMutexLocker locker(&mDiskMutex);
+    if (generation != mGeneration.load()) return; // the cache was cleared in the meantime
+    QSaveFile file(getThumbnailFilePath(key).toStr()); // readers never see partial files
+    if ((!file.open(QIODevice::WriteOnly)) || (file.write(png) != png.size()) ||
+        (!file.commit()))
+    {
+        qWarning() << "Could not write thumbnail:" << file.fileName();
+        return;
+    }
+    if (mDiskCacheSize >= 0) mDiskCacheSize += png.size();
+    if ((mDiskCacheSize < 0) || (mDiskCacheSize > sMaxDiskCacheSize)) trimDirectory();
+}
+
+void PreviewThumbnailCache::trimDirectory() noexcept
+{
+    // determine the size of all thumbnails (the directory must be locked by the caller)
+    QDir dir(mDirectory.toStr());
+    QFileInfoList files = dir.entryInfoList(QStringList("*.png"), QDir::Files, QDir::Time);
+    mDiskCacheSize = 0;
+    foreach (const QFileInfo& file, files)
+        mDiskCacheSize += file.size();
+
+    // if the limit is exceeded, remove the oldest files (sorted last) until there is space
+    // for some new thumbnails again, to not trim the directory after every written file
+    if (mDiskCacheSize <= sMaxDiskCacheSize) return;
+    while ((mDiskCacheSize > (sMaxDiskCacheSize * 3) / 4) && (!files.isEmpty())) {
+        QFileInfo file = files.takeLast();
+        if (dir.remove(file.fileName()))
+            mDiskCacheSize -= file.size();
+        else
+            qWarning() << "Could not remove thumbnail:" << file.fileName();
+    }
+}
+
+FilePath PreviewThumbnailCache::getThumbnailFilePath(const QString& key) const noexcept
+{
+    return mDirectory.getPathTo(key % ".png");
+}
+
+/*****************************************************************************************
+ *  Static Private Methods
+ ****************************************************************************************/
+
+QString PreviewThumbnailCache::buildKey(const QString& type, const LibraryBaseElement& element,
+                                        const Uuid& subUuid, const QStringList& localeOrder) noexcept
+{
+    // the locale order affects the rendered texts
+    QByteArray localeHash = QCryptographicHash::hash(localeOrder.join(",").toUtf8(),
+                                                     QCryptographicHash::Md5).toHex().left(8);
+    return QString("%1_%2_%3_%4_%5").arg(type, element.getUuid().toStr(),
+        element.getVersion().toStr(), subUuid.toStr(), QString(localeHash));
+}
+
+PreviewThumbnailCache::Renderer PreviewThumbnailCache::loadSymbolVariant(
+    const FilePath& cmpDir, const Uuid& symbVarUuid,
+    const QList<QPair<Uuid, FilePath>>& symbols, const QStringList& localeOrder,
+    QThread* guiThread) noexcept
+{
+    // this is called in a worker thread, so only the XML files are parsed here and the
+    // loaded elements are moved to the GUI thread, where they are rendered
+    try
+    {
+        QSharedPointer<Component> component(new Component(cmpDir, true));
+        component->moveToThread(guiThread);
+        QList<QPair<Uuid, QSharedPointer<Symbol>>> loadedSymbols;
+        for (int i = 0; i < symbols.count(); i++) {
+            QSharedPointer<Symbol> symbol(new Symbol(symbols.at(i).second, true));
+            symbol->moveToThread(guiThread);
+            loadedSymbols.append(qMakePair(symbols.at(i).first, symbol));
+        }
+        return [component, symbVarUuid, loadedSymbols, localeOrder]() -> QImage {
+            PreviewLayerProvider layerProvider;
+            QGraphicsScene scene; // must be destroyed before the layer provider!
+            for (int i = 0; i < loadedSymbols.count(); i++) {
+                SymbolPreviewGraphicsItem* item = new SymbolPreviewGraphicsItem(
+                    layerProvider, localeOrder, *loadedSymbols.at(i).second,
+                    component.data(), symbVarUuid, loadedSymbols.at(i).first);
+                // place the symbols below each other (like in the schematic editor)
+                item->setPos(0, scene.itemsBoundingRect().bottom() + item->boundingRect().height());
+                scene.addItem(item);
+            }
+            return renderScene(scene);
+        };
+    }
+    catch (const Exception& e)
+    {
+        qWarning() << "Could not load symbol variant thumbnail:" << e.getDebugMsg();
+        return Renderer();
+    }
+}
+
+PreviewThumbnailCache::Renderer PreviewThumbnailCache::loadFootprint(
+    const FilePath& pkgDir, const Uuid& footprintUuid, const QStringList& localeOrder,
+    QThread* guiThread) noexcept
+{
+    // see loadSymbolVariant()
+    try
+    {
+        QSharedPointer<Package> package(new Package(pkgDir, true));
+        if (!package->getFootprintByUuid(footprintUuid)) return Renderer();
+        package->moveToThread(guiThread);
+        return [package, footprintUuid, localeOrder]() -> QImage {
+            PreviewLayerProvider layerProvider;
+            QGraphicsScene scene; // must be destroyed before the layer provider!
+            scene.addItem(new FootprintPreviewGraphicsItem(layerProvider, localeOrder,
+                *package->getFootprintByUuid(footprintUuid), package.data()));
+            return renderScene(scene);
+        };
+    }
+    catch (const Exception& e)
+    {
+        qWarning() << "Could not load footprint thumbnail:" << e.getDebugMsg();
+        return Renderer();
+    }
+}
+
+QImage PreviewThumbnailCache::renderScene(QGraphicsScene& scene) noexcept
+{
+    QRectF rect = scene.itemsBoundingRect();
+    if (rect.isEmpty()) return QImage();
+
+    QSize size = rect.size().scaled(sThumbnailSize, sThumbnailSize, Qt::KeepAspectRatio)
+                 .toSize().expandedTo(QSize(1, 1));
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
+    scene.render(&painter, QRectF(image.rect()), rect, Qt::KeepAspectRatio);
+    painter.end();
+    return image;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
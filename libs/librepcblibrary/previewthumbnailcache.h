@@ -0,0 +1,172 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_LIBRARY_PREVIEWTHUMBNAILCACHE_H
+#define LIBREPCB_LIBRARY_PREVIEWTHUMBNAILCACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <QtConcurrent>
+#include <librepcbcommon/uuid.h>
+#include <librepcbcommon/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+class Library;
+class LibraryBaseElement;
+class Component;
+class Package;
+
+/*****************************************************************************************
+ *  Class PreviewThumbnailCache
+ ****************************************************************************************/
+
+/**
+ * @brief The PreviewThumbnailCache class provides preview images of library elements
+ *
+ * The thumbnails are identified by the type, UUID and version of the previewed element
+ * (and the UUID of the previewed symbol variant or footprint). They are kept in memory
+ * and stored as PNG files in a directory of the workspace metadata, so they are
+ * available immediately, even after restarting the application.
+ *
+ * If a requested thumbnail is not cached yet, a null pixmap is returned and the
+ * library elements are loaded on the global thread pool. The graphics items are then
+ * rendered in the GUI thread (QGraphicsScene and QGraphicsItem are not thread-safe),
+ * while the PNG encoding and writing is done on the thread pool again. The signal
+ * #thumbnailReady() is emitted as soon as the thumbnail is available. Thumbnails which
+ * could not be rendered (e.g. because of a parse error) are not tried again until the
+ * cache is cleared.
+ *
+ * The PNG files on the disk are limited to #sMaxDiskCacheSize bytes in total. If the
+ * limit is exceeded, the oldest files are removed.
+ *
+ * Because library elements can be modified without changing their version number,
+ * the whole cache must be cleared (#clear()) whenever a library rescan has modified
+ * the library (see Library#elementsModified()).
+ */
+class PreviewThumbnailCache final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        explicit PreviewThumbnailCache(const Library& library,
+                                       const FilePath& directory) noexcept;
+        ~PreviewThumbnailCache() noexcept;
+
+        // Getters
+
+        /**
+         * @brief Get the thumbnail of all symbols of a symbol variant of a component
+         *
+         * @return The thumbnail, or a null pixmap if it is not available yet
+         */
+        QPixmap getSymbolVariantThumbnail(const Component& component, const Uuid& symbVarUuid,
+                                          const QStringList& localeOrder) noexcept;
+
+        /**
+         * @brief Get the thumbnail of a footprint of a package
+         *
+         * @return The thumbnail, or a null pixmap if it is not available yet
+         */
+        QPixmap getFootprintThumbnail(const Package& package, const Uuid& footprintUuid,
+                                      const QStringList& localeOrder) noexcept;
+
+
+    public slots:
+
+        /**
+         * @brief Remove all thumbnails from the memory and from the disk
+         */
+        void clear() noexcept;
+
+
+    signals:
+
+        /**
+         * @brief A requested thumbnail was rendered (request it again to get it)
+         */
+        void thumbnailReady();
+
+
+    private:
+
+        // make some methods inaccessible...
+        PreviewThumbnailCache() = delete;
+        PreviewThumbnailCache(const PreviewThumbnailCache& other) = delete;
+        PreviewThumbnailCache& operator=(const PreviewThumbnailCache& rhs) = delete;
+
+        /// Renders the loaded library elements (must be called in the GUI thread)
+        typedef std::function<QImage()> Renderer;
+
+        // Private Methods
+        bool findThumbnail(const QString& key, QPixmap& pixmap) noexcept;
+        void startLoading(const QString& key, const std::function<Renderer()>& loader) noexcept;
+        void startWriting(const QString& key, const QImage& image, int generation) noexcept;
+        void writeThumbnail(const QString& key, const QImage& image, int generation) noexcept;
+        void trimDirectory() noexcept;
+        FilePath getThumbnailFilePath(const QString& key) const noexcept;
+
+        // Static Private Methods
+        static QString buildKey(const QString& type, const LibraryBaseElement& element,
+                                const Uuid& subUuid, const QStringList& localeOrder) noexcept;
+        static Renderer loadSymbolVariant(const FilePath& cmpDir, const Uuid& symbVarUuid,
+                                          const QList<QPair<Uuid, FilePath>>& symbols,
+                                          const QStringList& localeOrder,
+                                          QThread* guiThread) noexcept;
+        static Renderer loadFootprint(const FilePath& pkgDir, const Uuid& footprintUuid,
+                                      const QStringList& localeOrder,
+                                      QThread* guiThread) noexcept;
+        static QImage renderScene(QGraphicsScene& scene) noexcept;
+
+
+        // Attributes
+        const Library& mLibrary;
+        FilePath mDirectory; ///< the directory where the PNG files are stored
+        QCache<QString, QPixmap> mMemoryCache; ///< the cost of a pixmap is its size in kB
+        QHash<QString, QFutureWatcher<Renderer>*> mPendingLoads;
+        QSet<QString> mFailedKeys; ///< thumbnails which could not be rendered
+        QList<QFuture<void>> mPendingWrites;
+        QMutex mDiskMutex; ///< serializes writing, trimming and removing the PNG files
+        qint64 mDiskCacheSize; ///< size of all PNG files in bytes (-1 = not determined yet)
+        QAtomicInt mGeneration; ///< incremented by #clear() to discard outdated thumbnails
+
+        // Static Variables
+        static constexpr int sThumbnailSize = 256; ///< maximum width/height in pixels
+        static constexpr int sMemoryCacheSize = 20 * 1024; ///< maximum size in kB
+        static constexpr qint64 sMaxDiskCacheSize = 50 * 1024 * 1024; ///< maximum size in bytes
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_PREVIEWTHUMBNAILCACHE_H
@@ -77,6 +77,8 @@ SymbolPinPreviewGraphicsItem::~SymbolPinPreviewGraphicsItem() noexcept
 
 void SymbolPinPreviewGraphicsItem::updateCacheAndRepaint() noexcept
 {
+    prepareGeometryChange();
+
     mShape = QPainterPath();
     mShape.setFillRule(Qt::WindingFill);
     mBoundingRect = QRectF();
@@ -82,7 +82,7 @@ class SymbolPreviewGraphicsItem final : public GraphicsItem, public IF_Attribute
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged() {}
+        void attributesChanged(const QString& key = QString()) {Q_UNUSED(key);}
 
 
     private:
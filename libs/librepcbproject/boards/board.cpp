@@ -35,7 +35,10 @@
 #include <librepcbcommon/gridproperties.h>
 #include "../circuit/circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../circuit/componentinstance.h"
+#include "../circuit/componentsignalinstance.h"
+#include "../circuit/netsignal.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
 #include "items/bi_footprintpad.h"
@@ -44,6 +47,7 @@
 #include "items/bi_netline.h"
 #include <librepcblibrary/cmp/component.h>
 #include "items/bi_polygon.h"
+#include "graphicsitems/bgi_base.h"
 #include "boardlayerstack.h"
 
 /*****************************************************************************************
@@ -58,7 +62,7 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) throw (Exception) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mRevision(1), mIsAddedToProject(false), mConnectivityValid(false)
 {
     try
     {
@@ -146,6 +150,7 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
+        qDeleteAll(mErcMsgListUnroutedNetSignals);  mErcMsgListUnroutedNetSignals.clear();
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
         qDeleteAll(mPolygons);          mPolygons.clear();
         qDeleteAll(mNetLines);          mNetLines.clear();
@@ -161,9 +166,16 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
     }
 }
 
+Board::Board(Project& project, SmartXmlFile* xmlFile, const XmlDomDocument& doc) throw (Exception) :
+    Board(project, xmlFile->getFilepath(), false, false, false, QString(), xmlFile, &doc)
+{
+}
+
 Board::Board(Project& project, const FilePath& filepath, bool restore,
-             bool readOnly, bool create, const QString& newName) throw (Exception) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+             bool readOnly, bool create, const QString& newName,
+             SmartXmlFile* xmlFile, const XmlDomDocument* doc) throw (Exception) :
+    QObject(&project), mProject(project), mFilePath(filepath), mXmlFile(xmlFile),
+    mRevision(1), mIsAddedToProject(false), mConnectivityValid(false)
 {
     try
     {
@@ -189,8 +201,13 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         }
         else
         {
-            mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
-            QSharedPointer<XmlDomDocument> doc = mXmlFile->parseFileAndBuildDomTree(true);
+            QSharedPointer<XmlDomDocument> parsedDoc;
+            if (!mXmlFile) {
+                mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
+                parsedDoc = mXmlFile->parseFileAndBuildDomTree(true);
+                doc = parsedDoc.data();
+            }
+            Q_ASSERT(doc);
             XmlDomElement& root = doc->getRoot();
 
             // the board seems to be ready to open, so we will create all needed objects
@@ -282,6 +299,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
+        qDeleteAll(mErcMsgListUnroutedNetSignals);  mErcMsgListUnroutedNetSignals.clear();
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
         qDeleteAll(mPolygons);          mPolygons.clear();
         qDeleteAll(mNetLines);          mNetLines.clear();
@@ -301,6 +319,7 @@ Board::~Board() noexcept
 {
     Q_ASSERT(!mIsAddedToProject);
 
+    qDeleteAll(mErcMsgListUnroutedNetSignals);  mErcMsgListUnroutedNetSignals.clear();
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
 
     // delete all items
@@ -434,35 +453,54 @@ QList<BI_Base*> Board::getSelectedItems(bool vias,
 
 QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
 {
+    // The graphics scene returns the hit items in its own stacking order, so we collect
+    // them first and then build the list in the same order as the former linear scan
+    // over all items did: vias, netpoints, netlines and then footprints with their pads.
+    // The items of the same type are sorted by BI_Base#getAddedOrder(), which is the
+    // order of the item lists of the board.
     QPointF scenePosPx = pos.toPxQPointF();
-    QList<BI_Base*> list;   // Note: The order of adding the items is very important (the
-                            // top most item must appear as the first item in the list)!
-    // vias
-    foreach (BI_Via* via, mVias)
+    QSet<BI_Base*> hits;
+    QMap<quint64, BI_Base*> vias, netpoints, netlines;
+    QMap<Uuid, BI_Device*> devices; // same order as mDeviceInstances
+    foreach (BI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (via->isSelectable() && via->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(via);
-        }
-    }
-    // netpoints
-    foreach (BI_NetPoint* netpoint, mNetPoints)
-    {
-        if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(netpoint);
+        if ((!item->isSelectable()) || (!item->getGrabAreaScenePx().contains(scenePosPx))) {
+            continue;
         }
-    }
-    // netlines
-    foreach (BI_NetLine* netline, mNetLines)
-    {
-        if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(netline);
+        hits.insert(item);
+        switch (item->getType())
+        {
+            case BI_Base::Type_t::Via:
+                vias.insert(item->getAddedOrder(), item);
+                break;
+            case BI_Base::Type_t::NetPoint:
+                netpoints.insert(item->getAddedOrder(), item);
+                break;
+            case BI_Base::Type_t::NetLine:
+                netlines.insert(item->getAddedOrder(), item);
+                break;
+            case BI_Base::Type_t::Footprint: {
+                BI_Device& device = static_cast<BI_Footprint*>(item)->getDeviceInstance();
+                devices.insert(device.getComponentInstanceUuid(), &device);
+                break;
+            }
+            case BI_Base::Type_t::FootprintPad: {
+                BI_Device& device = static_cast<BI_FootprintPad*>(item)->getFootprint().getDeviceInstance();
+                devices.insert(device.getComponentInstanceUuid(), &device);
+                break;
+            }
+            default: break;
         }
     }
-    // footprints & pads
-    foreach (BI_Device* device, mDeviceInstances)
+    QList<BI_Base*> list;   // Note: The order of adding the items is very important (the
+                            // top most item must appear as the first item in the list)!
+    list.append(vias.values());
+    list.append(netpoints.values());
+    list.append(netlines.values());
+    foreach (BI_Device* device, devices)
     {
         BI_Footprint& footprint = device->getFootprint();
-        if (footprint.isSelectable() && footprint.getGrabAreaScenePx().contains(scenePosPx)) {
+        if (hits.contains(&footprint)) {
             if (footprint.getIsMirrored()) {
                 list.append(&footprint);
             } else {
@@ -471,12 +509,11 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
         }
         foreach (BI_FootprintPad* pad, footprint.getPads())
         {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(scenePosPx)) {
-                if (pad->getIsMirrored()) {
-                    list.append(pad);
-                } else {
-                    list.insert(1, pad);
-                }
+            if (!hits.contains(pad)) continue;
+            if (pad->getIsMirrored()) {
+                list.append(pad);
+            } else {
+                list.insert(qMin(1, list.count()), pad);
             }
         }
     }
@@ -485,10 +522,13 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
 
 QList<BI_Via*> Board::getViasAtScenePos(const Point& pos, const NetSignal* netsignal) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<BI_Via*> list;
-    foreach (BI_Via* via, mVias)
+    foreach (BI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (via->isSelectable() && via->getGrabAreaScenePx().contains(pos.toPxQPointF())
+        if (item->getType() != BI_Base::Type_t::Via) continue;
+        BI_Via* via = static_cast<BI_Via*>(item);
+        if (via->isSelectable() && via->getGrabAreaScenePx().contains(scenePosPx)
             && ((!netsignal) || (via->getNetSignal() == netsignal)))
         {
             list.append(via);
@@ -500,12 +540,15 @@ QList<BI_Via*> Board::getViasAtScenePos(const Point& pos, const NetSignal* netsi
 QList<BI_NetPoint*> Board::getNetPointsAtScenePos(const Point& pos, const BoardLayer* layer,
                                                   const NetSignal* netsignal) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<BI_NetPoint*> list;
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF())
-            && ((!layer) || (&netpoint->getLayer() == layer))
-            && ((!netsignal) || (&netpoint->getNetSignal() == netsignal)))
+        if (item->getType() != BI_Base::Type_t::NetPoint) continue;
+        BI_NetPoint* netpoint = static_cast<BI_NetPoint*>(item);
+        if (((!layer) || (&netpoint->getLayer() == layer))
+            && ((!netsignal) || (&netpoint->getNetSignal() == netsignal))
+            && netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(scenePosPx))
         {
             list.append(netpoint);
         }
@@ -516,12 +559,15 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(const Point& pos, const BoardL
 QList<BI_NetLine*> Board::getNetLinesAtScenePos(const Point& pos, const BoardLayer* layer,
                                                 const NetSignal* netsignal) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<BI_NetLine*> list;
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(pos.toPxQPointF())
-            && ((!layer) || (&netline->getLayer() == layer))
-            && ((!netsignal) || (&netline->getNetSignal() == netsignal)))
+        if (item->getType() != BI_Base::Type_t::NetLine) continue;
+        BI_NetLine* netline = static_cast<BI_NetLine*>(item);
+        if (((!layer) || (&netline->getLayer() == layer))
+            && ((!netsignal) || (&netline->getNetSignal() == netsignal))
+            && netline->isSelectable() && netline->getGrabAreaScenePx().contains(scenePosPx))
         {
             list.append(netline);
         }
@@ -532,17 +578,17 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(const Point& pos, const BoardLay
 QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const BoardLayer* layer,
                                                  const NetSignal* netsignal) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<BI_FootprintPad*> list;
-    foreach (BI_Device* device, mDeviceInstances)
+    foreach (BI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
+        if (item->getType() != BI_Base::Type_t::FootprintPad) continue;
+        BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item);
+        if (((!layer) || (pad->isOnLayer(layer->getId())))
+            && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal))
+            && pad->isSelectable() && pad->getGrabAreaScenePx().contains(scenePosPx))
         {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
-                && ((!layer) || (pad->isOnLayer(layer->getId())))
-                && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
-            {
-                list.append(pad);
-            }
+            list.append(pad);
         }
     }
     return list;
@@ -571,6 +617,7 @@ QList<BI_Base*> Board::getAllItems() const noexcept
 void Board::setGridProperties(const GridProperties& grid) noexcept
 {
     *mGridProperties = grid;
+    setModified();
 }
 
 /*****************************************************************************************
@@ -608,6 +655,7 @@ void Board::removeDeviceInstance(BI_Device& instance) throw (Exception)
     // remove from board
     instance.removeFromBoard(*mGraphicsScene); // can throw
     mDeviceInstances.remove(instance.getComponentInstanceUuid());
+    invalidateConnectivity();
     updateErcMessages();
     emit deviceRemoved(instance);
 }
@@ -639,6 +687,7 @@ void Board::addVia(BI_Via& via) throw (Exception)
     // add to board
     via.addToBoard(*mGraphicsScene); // can throw
     mVias.append(&via);
+    updateErcMessages();
 }
 
 void Board::removeVia(BI_Via& via) throw (Exception)
@@ -649,6 +698,7 @@ void Board::removeVia(BI_Via& via) throw (Exception)
     // remove from board
     via.removeFromBoard(*mGraphicsScene); // can throw
     mVias.removeOne(&via);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -680,6 +730,8 @@ void Board::addNetPoint(BI_NetPoint& netpoint) throw (Exception)
     // add to board
     netpoint.addToBoard(*mGraphicsScene); // can throw
     mNetPoints.append(&netpoint);
+    if (mConnectivityValid) addNetPointToConnectivity(netpoint);
+    updateErcMessages();
 }
 
 void Board::removeNetPoint(BI_NetPoint& netpoint) throw (Exception)
@@ -690,6 +742,7 @@ void Board::removeNetPoint(BI_NetPoint& netpoint) throw (Exception)
     // remove from board
     netpoint.removeFromBoard(*mGraphicsScene); // can throw
     mNetPoints.removeOne(&netpoint);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -721,6 +774,8 @@ void Board::addNetLine(BI_NetLine& netline) throw (Exception)
     // add to board
     netline.addToBoard(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    if (mConnectivityValid) addNetLineToConnectivity(netline);
+    updateErcMessages();
 }
 
 void Board::removeNetLine(BI_NetLine& netline) throw (Exception)
@@ -731,6 +786,7 @@ void Board::removeNetLine(BI_NetLine& netline) throw (Exception)
     // remove from board
     netline.removeFromBoard(*mGraphicsScene); // can throw
     mNetLines.removeOne(&netline);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -757,6 +813,44 @@ void Board::removePolygon(BI_Polygon& polygon) throw (Exception)
     mPolygons.removeOne(&polygon);
 }
 
+/*****************************************************************************************
+ *  Connectivity Methods
+ ****************************************************************************************/
+
+bool Board::areItemsConnected(const BI_Base& item1, const BI_Base& item2) const noexcept
+{
+    const BI_Base* node1 = getConnectivityNode(item1);
+    const BI_Base* node2 = getConnectivityNode(item2);
+    if ((!node1) || (!node2)) return false;
+    if (node1 == node2) return true;
+    updateConnectivity();
+    return mConnectivity.areInSameSet(node1, node2);
+}
+
+void Board::invalidateConnectivity() noexcept
+{
+    mConnectivityValid = false;
+    updateErcMessages(); // the routing state of some netsignals may have changed
+}
+
+bool Board::isNetSignalFullyRouted(const NetSignal& netsignal) const noexcept
+{
+    updateConnectivity();
+    const BI_Base* root = nullptr;
+    foreach (const ComponentSignalInstance* cmpSig, netsignal.getComponentSignals()) {
+        foreach (const BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
+            if (&pad->getBoard() != this) continue;
+            const BI_Base* padRoot = mConnectivity.find(pad);
+            if (!root) {
+                root = padRoot;
+            } else if (padRoot != root) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -795,7 +889,7 @@ void Board::removeFromProject() throw (Exception)
     sgl.dismiss();
 }
 
-bool Board::save(bool toOriginal, QStringList& errors) noexcept
+bool Board::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
@@ -804,9 +898,13 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
     {
         if (mIsAddedToProject)
         {
-            XmlDomDocument doc(*serializeToXmlDomElement());
-            doc.setFileVersion(APP_VERSION_MAJOR);
-            mXmlFile->save(doc, toOriginal);
+            if (!mXmlFile->tryUpdateToRevision(mRevision, toOriginal))
+            {
+                // the content was modified since the file was written the last time
+                QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+                doc->setFileVersion(APP_VERSION_MAJOR);
+                mXmlFile->save(doc, toOriginal, mRevision, writer);
+            }
         }
         else
         {
@@ -833,23 +931,26 @@ void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems)
     if (updateItems)
     {
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+        QSet<BI_Base*> itemsInRect;
+        foreach (BI_Base* item, getIndexedItemsInSceneRect(rectPx))
+        {
+            if (item->isSelectable() && item->getGrabAreaScenePx().intersects(rectPx))
+                itemsInRect.insert(item);
+        }
         foreach (BI_Device* component, mDeviceInstances)
         {
             BI_Footprint& footprint = component->getFootprint();
-            bool selectFootprint = footprint.isSelectable() && footprint.getGrabAreaScenePx().intersects(rectPx);
+            bool selectFootprint = itemsInRect.contains(&footprint);
             footprint.setSelected(selectFootprint);
             foreach (BI_FootprintPad* pad, footprint.getPads())
-            {
-                bool selectPad = pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-                pad->setSelected(selectFootprint || selectPad);
-            }
+                pad->setSelected(selectFootprint || itemsInRect.contains(pad));
         }
         foreach (BI_Via* via, mVias)
-            via->setSelected(via->isSelectable() && via->getGrabAreaScenePx().intersects(rectPx));
+            via->setSelected(itemsInRect.contains(via));
         foreach (BI_NetPoint* netpoint, mNetPoints)
-            netpoint->setSelected(netpoint->isSelectable() && netpoint->getGrabAreaScenePx().intersects(rectPx));
+            netpoint->setSelected(itemsInRect.contains(netpoint));
         foreach (BI_NetLine* netline, mNetLines)
-            netline->setSelected(netline->isSelectable() && netline->getGrabAreaScenePx().intersects(rectPx));
+            netline->setSelected(itemsInRect.contains(netline));
     }
 }
 
@@ -884,8 +985,85 @@ bool Board::getAttributeValue(const QString& attrNS, const QString& attrKey,
  *  Private Methods
  ****************************************************************************************/
 
+QList<BI_Base*> Board::getIndexedItemsAtScenePos(const QPointF& scenePosPx) const noexcept
+{
+    // The BSP tree of the graphics scene is kept up to date by Qt whenever an item is
+    // added, removed, moved or changes its geometry, so we use it as our spatial index
+    // and only the candidates from there need to be checked against their grab area.
+    mGraphicsScene->processScheduledCacheUpdates(); // geometry must be up to date
+    QList<BI_Base*> list;
+    foreach (QGraphicsItem* item, mGraphicsScene->items(scenePosPx, Qt::IntersectsItemBoundingRect))
+    {
+        BGI_Base* graphicsItem = dynamic_cast<BGI_Base*>(item);
+        if (graphicsItem) list.append(&graphicsItem->getBoardItem());
+    }
+    return list;
+}
+
+QList<BI_Base*> Board::getIndexedItemsInSceneRect(const QRectF& sceneRectPx) const noexcept
+{
+    mGraphicsScene->processScheduledCacheUpdates(); // geometry must be up to date
+    QList<BI_Base*> list;
+    foreach (QGraphicsItem* item, mGraphicsScene->items(sceneRectPx, Qt::IntersectsItemBoundingRect))
+    {
+        BGI_Base* graphicsItem = dynamic_cast<BGI_Base*>(item);
+        if (graphicsItem) list.append(&graphicsItem->getBoardItem());
+    }
+    return list;
+}
+
+const BI_Base* Board::getConnectivityNode(const BI_Base& item) const noexcept
+{
+    switch (item.getType())
+    {
+        case BI_Base::Type_t::NetPoint:
+        case BI_Base::Type_t::Via:
+        case BI_Base::Type_t::FootprintPad:
+            return &item;
+        case BI_Base::Type_t::NetLine: {
+            // a netline is always connected to its start (and end) point
+            const BI_NetLine* netline = dynamic_cast<const BI_NetLine*>(&item); Q_ASSERT(netline);
+            return &netline->getStartPoint();
+        }
+        default:
+            return nullptr;
+    }
+}
+
+void Board::addNetPointToConnectivity(const BI_NetPoint& netpoint) const noexcept
+{
+    if (netpoint.getFootprintPad()) {
+        mConnectivity.unite(&netpoint, netpoint.getFootprintPad());
+    } else if (netpoint.getVia()) {
+        mConnectivity.unite(&netpoint, netpoint.getVia());
+    } else {
+        mConnectivity.add(&netpoint);
+    }
+}
+
+void Board::addNetLineToConnectivity(const BI_NetLine& netline) const noexcept
+{
+    mConnectivity.unite(&netline.getStartPoint(), &netline.getEndPoint());
+}
+
+void Board::updateConnectivity() const noexcept
+{
+    if (mConnectivityValid) return;
+
+    // removing items is not possible with a disjoint set, so it is rebuilt from scratch
+    mConnectivity.clear();
+    foreach (const BI_NetPoint* netpoint, mNetPoints) {
+        addNetPointToConnectivity(*netpoint);
+    }
+    foreach (const BI_NetLine* netline, mNetLines) {
+        addNetLineToConnectivity(*netline);
+    }
+    mConnectivityValid = true;
+}
+
 void Board::updateIcon() noexcept
 {
+    mGraphicsScene->processScheduledCacheUpdates();
     QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
@@ -945,6 +1123,10 @@ XmlDomElement* Board::serializeToXmlDomElement() const throw (Exception)
 
 void Board::updateErcMessages() noexcept
 {
+    if (mProject.getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     // type: UnplacedComponent (ComponentInstances without DeviceInstance)
     if (mIsAddedToProject)
     {
@@ -977,6 +1159,43 @@ void Board::updateErcMessages() noexcept
         qDeleteAll(mErcMsgListUnplacedComponentInstances);
         mErcMsgListUnplacedComponentInstances.clear();
     }
+
+    // type: UnroutedNetSignal (NetSignals with footprint pads which are not connected)
+    // Note: After removing items, this rebuilds the whole connectivity in O(n), but
+    // within a command of the undo stack it is done only once (see deferUpdate() above).
+    if (mIsAddedToProject)
+    {
+        const QMap<Uuid, NetSignal*>& netsignals = mProject.getCircuit().getNetSignals();
+        foreach (const NetSignal* netsignal, netsignals)
+        {
+            ErcMsg* ercMsg = mErcMsgListUnroutedNetSignals.value(netsignal->getUuid());
+            if (!isNetSignalFullyRouted(*netsignal))
+            {
+                if (!ercMsg) {
+                    ercMsg = new ErcMsg(mProject, *this, QString("%1/%2").arg(mUuid.toStr(),
+                        netsignal->getUuid().toStr()), "UnroutedNetSignal",
+                        ErcMsg::ErcMsgType_t::BoardWarning);
+                    mErcMsgListUnroutedNetSignals.insert(netsignal->getUuid(), ercMsg);
+                }
+                ercMsg->setMsg(QString(tr("Net signal not fully routed: \"%1\" (Board: %2)"))
+                               .arg(netsignal->getName(), mName));
+                ercMsg->setVisible(true);
+            }
+            else if (ercMsg)
+            {
+                delete mErcMsgListUnroutedNetSignals.take(netsignal->getUuid());
+            }
+        }
+        foreach (const Uuid& uuid, mErcMsgListUnroutedNetSignals.keys()) {
+            if (!netsignals.contains(uuid))
+                delete mErcMsgListUnroutedNetSignals.take(uuid);
+        }
+    }
+    else
+    {
+        qDeleteAll(mErcMsgListUnroutedNetSignals);
+        mErcMsgListUnroutedNetSignals.clear();
+    }
 }
 
 /*****************************************************************************************
@@ -31,6 +31,7 @@
 #include <librepcbcommon/fileio/filepath.h>
 #include <librepcbcommon/exceptions.h>
 #include <librepcbcommon/uuid.h>
+#include <librepcbcommon/disjointset.h>
 #include "../erc/if_ercmsgprovider.h"
 
 /*****************************************************************************************
@@ -42,6 +43,8 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class SmartXmlFileWriter;
+class XmlDomDocument;
 class BoardLayer;
 class BoardDesignRules;
 
@@ -101,6 +104,19 @@ class Board final : public QObject, public IF_AttributeProvider,
         Board(const Board& other, const FilePath& filepath, const QString& name) throw (Exception);
         Board(Project& project, const FilePath& filepath, bool restore, bool readOnly) throw (Exception) :
             Board(project, filepath, restore, readOnly, false, QString()) {}
+
+        /**
+         * @brief Load a board from a file which was already opened and parsed
+         *
+         * This allows to open and parse the (expensive) XML files in worker threads
+         * while the board objects are created in the main thread.
+         *
+         * @param project   The project of the board
+         * @param xmlFile   The opened board file (the ownership is transferred to the new
+         *                  board object, even if the constructor throws)
+         * @param doc       The parsed DOM tree of the file
+         */
+        Board(Project& project, SmartXmlFile* xmlFile, const XmlDomDocument& doc) throw (Exception);
         ~Board() noexcept;
 
         // Getters: General
@@ -169,10 +185,39 @@ class Board final : public QObject, public IF_AttributeProvider,
         void addPolygon(BI_Polygon& polygon) throw (Exception);
         void removePolygon(BI_Polygon& polygon) throw (Exception);
 
+        // Connectivity Methods
+
+        /**
+         * @brief Check whether two copper items are physically connected by traces/vias
+         *
+         * Only vias, footprint pads, netpoints and netlines can be connected, for all other
+         * items this method returns false.
+         */
+        bool areItemsConnected(const BI_Base& item1, const BI_Base& item2) const noexcept;
+
+        /**
+         * @brief Check whether all footprint pads of a netsignal on this board are connected
+         */
+        bool isNetSignalFullyRouted(const NetSignal& netsignal) const noexcept;
+
+        /**
+         * @brief Mark the connectivity as outdated (it is rebuilt on the next query)
+         *
+         * This is called automatically if an item is removed from the board, if a
+         * netpoint gets attached to or detached from a pad or via, or if a pad gets
+         * another netsignal. The ERC messages of unrouted netsignals are updated too.
+         *
+         * @note A disjoint set can't remove elements, so the next query rebuilds the
+         *       connectivity of the whole board in O(n) (n = count of netpoints and
+         *       netlines). Adding items is incremental and does not invalidate it.
+         */
+        void invalidateConnectivity() noexcept;
+
         // General Methods
         void addToProject() throw (Exception);
         void removeFromProject() throw (Exception);
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        void setModified() noexcept {++mRevision;}
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer = nullptr) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
@@ -196,7 +241,7 @@ class Board final : public QObject, public IF_AttributeProvider,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
         void deviceAdded(BI_Device& comp);
         void deviceRemoved(BI_Device& comp);
@@ -205,13 +250,20 @@ class Board final : public QObject, public IF_AttributeProvider,
     private:
 
         Board(Project& project, const FilePath& filepath, bool restore,
-              bool readOnly, bool create, const QString& newName) throw (Exception);
+              bool readOnly, bool create, const QString& newName,
+              SmartXmlFile* xmlFile = nullptr, const XmlDomDocument* doc = nullptr) throw (Exception);
         void updateIcon() noexcept;
+        QList<BI_Base*> getIndexedItemsAtScenePos(const QPointF& scenePosPx) const noexcept;
+        QList<BI_Base*> getIndexedItemsInSceneRect(const QRectF& sceneRectPx) const noexcept;
+        const BI_Base* getConnectivityNode(const BI_Base& item) const noexcept;
+        void addNetPointToConnectivity(const BI_NetPoint& netpoint) const noexcept;
+        void addNetLineToConnectivity(const BI_NetLine& netline) const noexcept;
+        void updateConnectivity() const noexcept;
 
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
         /// @copydoc IF_XmlSerializableObject#serializeToXmlDomElement()
         XmlDomElement* serializeToXmlDomElement() const throw (Exception) override;
@@ -221,6 +273,7 @@ class Board final : public QObject, public IF_AttributeProvider,
         Project& mProject; ///< A reference to the Project object (from the ctor)
         FilePath mFilePath; ///< the filepath of the schematic *.xml file (from the ctor)
         QScopedPointer<SmartXmlFile> mXmlFile;
+        quint64 mRevision; ///< incremented on every modification, see #setModified()
         bool mIsAddedToProject;
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
@@ -241,8 +294,13 @@ class Board final : public QObject, public IF_AttributeProvider,
         QList<BI_NetLine*> mNetLines;
         QList<BI_Polygon*> mPolygons;
 
+        // connectivity (each set contains all physically connected netpoints/vias/pads)
+        mutable DisjointSet<const BI_Base*> mConnectivity;
+        mutable bool mConnectivityValid; ///< if false, #mConnectivity must be rebuilt
+
         // ERC messages
         QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
+        QHash<Uuid, ErcMsg*> mErcMsgListUnroutedNetSignals; ///< key: netsignal UUID
 };
 
 /*****************************************************************************************
@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent>
 #include "boardgerberexport.h"
 #include <librepcbcommon/cam/gerbergenerator.h>
 #include <librepcbcommon/cam/excellongenerator.h>
@@ -65,20 +66,99 @@ BoardGerberExport::~BoardGerberExport() noexcept
 
 void BoardGerberExport::exportAllLayers() const throw (Exception)
 {
-    exportDrillsPTH();
-    exportLayerBoardOutlines();
-    exportLayerTopCopper();
-    exportLayerTopSolderMask();
-    exportLayerTopOverlay();
-    exportLayerBottomCopper();
-    exportLayerBottomSolderMask();
-    exportLayerBottomOverlay();
+    // collect the items of all layers in a single pass over the board...
+    LayerContents contents = collectLayerContents();
+
+    // ...and generate all output files in parallel since they are independent
+    QList<QFuture<void>> futures;
+    futures.append(QtConcurrent::run([this](){exportDrillsPTH();}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerBoardOutlines(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerTopCopper(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerTopSolderMask(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerTopOverlay(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerBottomCopper(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerBottomSolderMask(contents);}));
+    futures.append(QtConcurrent::run([this, &contents](){exportLayerBottomOverlay(contents);}));
+
+    // wait until all threads are finished (they access "contents"!), then rethrow the
+    // first exception which occurred (if any)
+    QScopedPointer<Exception> error;
+    foreach (QFuture<void> future, futures) {
+        try {
+            future.waitForFinished(); // rethrows exceptions from the worker thread
+        } catch (const Exception& e) {
+            if (!error) error.reset(e.clone());
+        }
+    }
+    if (error) error->raise();
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+BoardGerberExport::LayerContents BoardGerberExport::collectLayerContents() const noexcept
+{
+    LayerContents contents;
+
+    // footprints incl. pads
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        Q_ASSERT(device);
+        const BI_Footprint& footprint = device->getFootprint();
+        const library::Footprint& libFootprint = footprint.getLibFootprint();
+        foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+            foreach (int layerId, getExportedLayers()) {
+                if (isFootprintPadOnLayer(*pad, layerId)) {
+                    contents[layerId].pads.append(pad);
+                }
+            }
+        }
+        for (int i = 0; i < libFootprint.getPolygonCount(); ++i) {
+            const Polygon* polygon = libFootprint.getPolygon(i); Q_ASSERT(polygon);
+            int layerId = footprint.getIsMirrored() ?
+                BoardLayer::getMirroredLayerId(polygon->getLayerId()) : polygon->getLayerId();
+            contents[layerId].footprintPolygons.append(qMakePair(&footprint, polygon));
+        }
+        for (int i = 0; i < libFootprint.getEllipseCount(); ++i) {
+            const Ellipse* ellipse = libFootprint.getEllipse(i); Q_ASSERT(ellipse);
+            int layerId = footprint.getIsMirrored() ?
+                BoardLayer::getMirroredLayerId(ellipse->getLayerId()) : ellipse->getLayerId();
+            contents[layerId].footprintEllipses.append(qMakePair(&footprint, ellipse));
+        }
+        // TODO: texts
+        for (int i = 0; i < libFootprint.getHoleCount(); ++i) {
+            const Hole* hole = libFootprint.getHole(i); Q_ASSERT(hole);
+            foreach (int layerId, getExportedLayers()) { // holes are drawn on all layers
+                contents[layerId].footprintHoles.append(qMakePair(&footprint, hole));
+            }
+        }
+    }
+
+    // vias
+    foreach (const BI_Via* via, mBoard.getVias()) {
+        Q_ASSERT(via);
+        foreach (int layerId, getExportedLayers()) {
+            if (isViaOnLayer(*via, layerId)) {
+                contents[layerId].vias.append(via);
+            }
+        }
+    }
+
+    // traces
+    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
+        Q_ASSERT(netline);
+        contents[netline->getLayer().getId()].netlines.append(netline);
+    }
+
+    // polygons
+    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+        Q_ASSERT(polygon);
+        contents[polygon->getPolygon().getLayerId()].polygons.append(polygon);
+    }
+
+    return contents;
+}
+
 void BoardGerberExport::exportDrillsPTH() const throw (Exception)
 {
     ExcellonGenerator gen;
@@ -109,114 +189,141 @@ void BoardGerberExport::exportDrillsPTH() const throw (Exception)
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerBoardOutlines() const throw (Exception)
+void BoardGerberExport::exportLayerBoardOutlines(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::BoardOutlines);
+    drawLayer(gen, contents, BoardLayer::BoardOutlines);
     gen.generate();
     QString filename = QString("%1_OUTLINES.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerTopCopper() const throw (Exception)
+void BoardGerberExport::exportLayerTopCopper(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::TopCopper);
+    drawLayer(gen, contents, BoardLayer::TopCopper);
     gen.generate();
     QString filename = QString("%1_COPPER-TOP.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerTopSolderMask() const throw (Exception)
+void BoardGerberExport::exportLayerTopSolderMask(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::TopStopMask);
+    drawLayer(gen, contents, BoardLayer::TopStopMask);
     gen.generate();
     QString filename = QString("%1_SOLDERMASK-TOP.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerTopOverlay() const throw (Exception)
+void BoardGerberExport::exportLayerTopOverlay(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::TopOverlay);
+    drawLayer(gen, contents, BoardLayer::TopOverlay);
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, BoardLayer::TopStopMask);
+    drawLayer(gen, contents, BoardLayer::TopStopMask);
     gen.generate();
     QString filename = QString("%1_SILKSCREEN-TOP.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerBottomCopper() const throw (Exception)
+void BoardGerberExport::exportLayerBottomCopper(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::BottomCopper);
+    drawLayer(gen, contents, BoardLayer::BottomCopper);
     gen.generate();
     QString filename = QString("%1_COPPER-BOTTOM.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerBottomSolderMask() const throw (Exception)
+void BoardGerberExport::exportLayerBottomSolderMask(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::BottomStopMask);
+    drawLayer(gen, contents, BoardLayer::BottomStopMask);
     gen.generate();
     QString filename = QString("%1_SOLDERMASK-BOTTOM.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::exportLayerBottomOverlay() const throw (Exception)
+void BoardGerberExport::exportLayerBottomOverlay(const LayerContents& contents) const throw (Exception)
 {
     GerberGenerator gen(mProject.getName(), mBoard.getUuid(), mBoard.getName());
-    drawLayer(gen, BoardLayer::BottomOverlay);
+    drawLayer(gen, contents, BoardLayer::BottomOverlay);
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, BoardLayer::BottomStopMask);
+    drawLayer(gen, contents, BoardLayer::BottomStopMask);
     gen.generate();
     QString filename = QString("%1_SILKSCREEN-BOTTOM.gbr").arg(mProject.getName());
     gen.saveToFile(mOutputDirectory.getPathTo(filename));
 }
 
-void BoardGerberExport::drawLayer(GerberGenerator& gen, int layerId) const throw (Exception)
+void BoardGerberExport::drawLayer(GerberGenerator& gen, const LayerContents& contents,
+                                  int layerId) const throw (Exception)
 {
-    // draw footprints incl. pads
-    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-        Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerId);
+    const LayerContent content = contents.value(layerId);
+
+    // draw footprint pads
+    foreach (const BI_FootprintPad* pad, content.pads) {
+        drawFootprintPad(gen, *pad, layerId);
+    }
+
+    // draw footprint polygons
+    typedef QPair<const BI_Footprint*, const Polygon*> FootprintPolygon;
+    foreach (const FootprintPolygon& item, content.footprintPolygons) {
+        const BI_Footprint& footprint = *item.first;
+        Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
+        Polygon p = item.second->rotated(rot).translate(footprint.getPosition());
+        p.setLineWidth(calcWidthOfLayer(p.getLineWidth(), item.second->getLayerId()));
+        gen.drawPolygonOutline(p);
+        if (p.isFilled()) {
+            gen.drawPolygonArea(p);
+        }
+    }
+
+    // draw footprint ellipses
+    typedef QPair<const BI_Footprint*, const Ellipse*> FootprintEllipse;
+    foreach (const FootprintEllipse& item, content.footprintEllipses) {
+        const BI_Footprint& footprint = *item.first;
+        Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
+        Ellipse e = item.second->rotated(rot).translate(footprint.getPosition());
+        e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), item.second->getLayerId()));
+        gen.drawEllipseOutline(e);
+        if (e.isFilled()) {
+            gen.drawEllipseArea(e);
+        }
+    }
+
+    // draw footprint holes
+    typedef QPair<const BI_Footprint*, const Hole*> FootprintHole;
+    foreach (const FootprintHole& item, content.footprintHoles) {
+        gen.flashCircle(item.first->mapToScene(item.second->getPosition()),
+                        item.second->getDiameter(), Length(0));
     }
 
     // draw vias
-    foreach (const BI_Via* via, mBoard.getVias()) {
-        Q_ASSERT(via);
+    foreach (const BI_Via* via, content.vias) {
         drawVia(gen, *via, layerId);
     }
 
     // draw traces
-    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
-        Q_ASSERT(netline);
-        if (netline->getLayer().getId() == layerId) {
-            gen.drawLine(netline->getStartPoint().getPosition(),
-                         netline->getEndPoint().getPosition(),
-                         netline->getWidth());
-        }
+    foreach (const BI_NetLine* netline, content.netlines) {
+        gen.drawLine(netline->getStartPoint().getPosition(),
+                     netline->getEndPoint().getPosition(),
+                     netline->getWidth());
     }
 
     // draw polygons
-    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-        Q_ASSERT(polygon);
-        if (layerId == polygon->getPolygon().getLayerId()) {
-            Polygon p(polygon->getPolygon());
-            p.setLineWidth(calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerId));
-            gen.drawPolygonOutline(p);
-        }
+    foreach (const BI_Polygon* polygon, content.polygons) {
+        Polygon p(polygon->getPolygon());
+        p.setLineWidth(calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerId));
+        gen.drawPolygonOutline(p);
     }
 }
 
 void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, int layerId) const throw (Exception)
 {
-    bool drawCopper = via.isOnLayer(layerId);
     bool drawStopMask = (layerId == BoardLayer::TopStopMask || layerId == BoardLayer::BottomStopMask)
                         && mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter());
-    if (drawCopper || drawStopMask) {
+    if (isViaOnLayer(via, layerId)) {
         Length outerDiameter = via.getSize();
         if (drawStopMask) {
             outerDiameter += mBoard.getDesignRules().calcStopMaskClearance(via.getSize()) * 2;
@@ -244,60 +351,13 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, int lay
     }
 }
 
-void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, int layerId) const throw (Exception)
-{
-    // draw pads
-    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerId);
-    }
-
-    // draw polygons
-    for (int i = 0; i < footprint.getLibFootprint().getPolygonCount(); ++i) {
-        const Polygon* polygon = footprint.getLibFootprint().getPolygon(i); Q_ASSERT(polygon);
-        int layer = footprint.getIsMirrored() ? BoardLayer::getMirroredLayerId(layerId) : layerId;
-        if (layer == polygon->getLayerId()) {
-            Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
-            Polygon p = polygon->rotated(rot).translate(footprint.getPosition());
-            p.setLineWidth(calcWidthOfLayer(p.getLineWidth(), layer));
-            gen.drawPolygonOutline(p);
-            if (p.isFilled()) {
-                gen.drawPolygonArea(p);
-            }
-        }
-    }
-
-    // draw ellipses
-    for (int i = 0; i < footprint.getLibFootprint().getEllipseCount(); ++i) {
-        const Ellipse* ellipse = footprint.getLibFootprint().getEllipse(i); Q_ASSERT(ellipse);
-        int layer = footprint.getIsMirrored() ? BoardLayer::getMirroredLayerId(layerId) : layerId;
-        if (layer == ellipse->getLayerId()) {
-            Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
-            Ellipse e = ellipse->rotated(rot).translate(footprint.getPosition());
-            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
-            gen.drawEllipseOutline(e);
-            if (e.isFilled()) {
-                gen.drawEllipseArea(e);
-            }
-        }
-    }
-
-    // TODO: draw texts
-
-    // draw holes
-    for (int i = 0; i < footprint.getLibFootprint().getHoleCount(); ++i) {
-        const Hole* hole = footprint.getLibFootprint().getHole(i); Q_ASSERT(hole);
-        gen.flashCircle(footprint.mapToScene(hole->getPosition()), hole->getDiameter(), Length(0));
-    }
-}
-
 void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, int layerId) const throw (Exception)
 {
-    bool isOnCopperLayer = pad.isOnLayer(layerId);
-    bool isOnSolderMaskTop = pad.isOnLayer(BoardLayer::LayerID::TopCopper) && (layerId == BoardLayer::LayerID::TopStopMask);
-    bool isOnSolderMaskBottom = pad.isOnLayer(BoardLayer::LayerID::BottomCopper) && (layerId == BoardLayer::LayerID::BottomStopMask);
-    if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom) {
+    if (!isFootprintPadOnLayer(pad, layerId)) {
         return;
     }
+    bool isOnSolderMaskTop = (layerId == BoardLayer::LayerID::TopStopMask);
+    bool isOnSolderMaskBottom = (layerId == BoardLayer::LayerID::BottomStopMask);
 
     Angle rot = pad.getIsMirrored() ? -pad.getRotation() : pad.getRotation();
     const library::FootprintPad& libPad = pad.getLibPad();
@@ -353,6 +413,21 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_Footprin
     }
 }
 
+bool BoardGerberExport::isViaOnLayer(const BI_Via& via, int layerId) const noexcept
+{
+    bool isOnStopMask = (layerId == BoardLayer::TopStopMask || layerId == BoardLayer::BottomStopMask)
+                        && mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter());
+    return via.isOnLayer(layerId) || isOnStopMask;
+}
+
+bool BoardGerberExport::isFootprintPadOnLayer(const BI_FootprintPad& pad, int layerId) const noexcept
+{
+    bool isOnCopperLayer = pad.isOnLayer(layerId);
+    bool isOnSolderMaskTop = pad.isOnLayer(BoardLayer::LayerID::TopCopper) && (layerId == BoardLayer::LayerID::TopStopMask);
+    bool isOnSolderMaskBottom = pad.isOnLayer(BoardLayer::LayerID::BottomCopper) && (layerId == BoardLayer::LayerID::BottomStopMask);
+    return isOnCopperLayer || isOnSolderMaskTop || isOnSolderMaskBottom;
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -366,6 +441,15 @@ Length BoardGerberExport::calcWidthOfLayer(const Length& width, int layerId) noe
     }
 }
 
+const QList<int>& BoardGerberExport::getExportedLayers() noexcept
+{
+    static QList<int> layers = {BoardLayer::BoardOutlines,
+                                BoardLayer::TopCopper, BoardLayer::TopStopMask,
+                                BoardLayer::TopOverlay, BoardLayer::BottomCopper,
+                                BoardLayer::BottomStopMask, BoardLayer::BottomOverlay};
+    return layers;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
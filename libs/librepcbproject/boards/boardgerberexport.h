@@ -35,6 +35,7 @@ namespace librepcb {
 
 class Polygon;
 class Ellipse;
+class Hole;
 class GerberGenerator;
 
 namespace project {
@@ -44,6 +45,8 @@ class Board;
 class BI_Via;
 class BI_Footprint;
 class BI_FootprintPad;
+class BI_NetLine;
+class BI_Polygon;
 
 /*****************************************************************************************
  *  Class BoardGerberExport
@@ -76,23 +79,45 @@ class BoardGerberExport final : public QObject
 
     private:
 
+        // Private Types
+
+        /**
+         * @brief All board items which have to be drawn on a specific layer
+         *
+         * These lists are filled by #collectLayerContents() in a single pass over all
+         * items of the board, so the layers can be generated independently afterwards.
+         */
+        struct LayerContent {
+            QList<const BI_FootprintPad*> pads;
+            QList<QPair<const BI_Footprint*, const Polygon*>> footprintPolygons;
+            QList<QPair<const BI_Footprint*, const Ellipse*>> footprintEllipses;
+            QList<QPair<const BI_Footprint*, const Hole*>> footprintHoles;
+            QList<const BI_Via*> vias;
+            QList<const BI_NetLine*> netlines;
+            QList<const BI_Polygon*> polygons;
+        };
+        typedef QHash<int, LayerContent> LayerContents; ///< key: layer ID
+
         // Private Methods
+        LayerContents collectLayerContents() const noexcept;
         void exportDrillsPTH() const throw (Exception);
-        void exportLayerBoardOutlines() const throw (Exception);
-        void exportLayerTopCopper() const throw (Exception);
-        void exportLayerTopSolderMask() const throw (Exception);
-        void exportLayerTopOverlay() const throw (Exception);
-        void exportLayerBottomCopper() const throw (Exception);
-        void exportLayerBottomSolderMask() const throw (Exception);
-        void exportLayerBottomOverlay() const throw (Exception);
-
-        void drawLayer(GerberGenerator& gen, int layerId) const throw (Exception);
+        void exportLayerBoardOutlines(const LayerContents& contents) const throw (Exception);
+        void exportLayerTopCopper(const LayerContents& contents) const throw (Exception);
+        void exportLayerTopSolderMask(const LayerContents& contents) const throw (Exception);
+        void exportLayerTopOverlay(const LayerContents& contents) const throw (Exception);
+        void exportLayerBottomCopper(const LayerContents& contents) const throw (Exception);
+        void exportLayerBottomSolderMask(const LayerContents& contents) const throw (Exception);
+        void exportLayerBottomOverlay(const LayerContents& contents) const throw (Exception);
+
+        void drawLayer(GerberGenerator& gen, const LayerContents& contents, int layerId) const throw (Exception);
         void drawVia(GerberGenerator& gen, const BI_Via& via, int layerId) const throw (Exception);
-        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, int layerId) const throw (Exception);
         void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, int layerId) const throw (Exception);
+        bool isViaOnLayer(const BI_Via& via, int layerId) const noexcept;
+        bool isFootprintPadOnLayer(const BI_FootprintPad& pad, int layerId) const noexcept;
 
         // Static Methods
         static Length calcWidthOfLayer(const Length& width, int layerId) noexcept;
+        static const QList<int>& getExportedLayers() noexcept;
 
 
         // Private Member Variables
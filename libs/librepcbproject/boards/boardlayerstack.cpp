@@ -150,6 +150,7 @@ XmlDomElement* BoardLayerStack::serializeToXmlDomElement() const throw (Exceptio
 
 void BoardLayerStack::layerAttributesChanged() noexcept
 {
+    mBoard.setModified(); // the layer attributes are stored in the board file
     if (!mLayersChanged) {
         emit mBoard.attributesChanged();
         mLayersChanged = true;
@@ -59,12 +59,14 @@ bool CmdBoardDesignRulesModify::performExecute() throw (Exception)
 
 void CmdBoardDesignRulesModify::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.getDesignRules() = mOldRules;
     emit mBoard.attributesChanged();
 }
 
 void CmdBoardDesignRulesModify::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.getDesignRules() = mNewRules;
     emit mBoard.attributesChanged();
 }
@@ -72,11 +72,13 @@ bool CmdBoardNetLineAdd::performExecute() throw (Exception)
 
 void CmdBoardNetLineAdd::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetLine(*mNetLine); // can throw
 }
 
 void CmdBoardNetLineAdd::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetLine(*mNetLine); // can throw
 }
 
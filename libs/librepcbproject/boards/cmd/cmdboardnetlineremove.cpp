@@ -45,6 +45,19 @@ CmdBoardNetLineRemove::~CmdBoardNetLineRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetLineRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        size += sizeof(BI_NetLine) + 512; // the removed netline and its graphics item
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +71,13 @@ bool CmdBoardNetLineRemove::performExecute() throw (Exception)
 
 void CmdBoardNetLineRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetLine(mNetLine); // can throw
 }
 
 void CmdBoardNetLineRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetLine(mNetLine); // can throw
 }
 
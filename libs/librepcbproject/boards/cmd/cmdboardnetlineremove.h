@@ -50,6 +50,11 @@ class CmdBoardNetLineRemove final : public UndoCommand
         explicit CmdBoardNetLineRemove(BI_NetLine& netline) noexcept;
         ~CmdBoardNetLineRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
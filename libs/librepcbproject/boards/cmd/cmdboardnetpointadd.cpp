@@ -94,11 +94,13 @@ bool CmdBoardNetPointAdd::performExecute() throw (Exception)
 
 void CmdBoardNetPointAdd::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetPoint(*mNetPoint); // can throw
 }
 
 void CmdBoardNetPointAdd::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetPoint(*mNetPoint); // can throw
 }
 
@@ -26,6 +26,7 @@
 #include "../items/bi_netpoint.h"
 #include "../items/bi_footprintpad.h"
 #include "../items/bi_via.h"
+#include "../board.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -111,6 +112,7 @@ bool CmdBoardNetPointEdit::performExecute() throw (Exception)
 
 void CmdBoardNetPointEdit::performUndo() throw (Exception)
 {
+    mNetPoint.getBoard().setModified();
     ScopeGuardList sgl;
     mNetPoint.setLayer(*mOldLayer); // can throw
     sgl.add([&](){mNetPoint.setLayer(*mNewLayer);});
@@ -126,6 +128,7 @@ void CmdBoardNetPointEdit::performUndo() throw (Exception)
 
 void CmdBoardNetPointEdit::performRedo() throw (Exception)
 {
+    mNetPoint.getBoard().setModified();
     ScopeGuardList sgl;
     mNetPoint.setLayer(*mNewLayer); // can throw
     sgl.add([&](){mNetPoint.setLayer(*mOldLayer);});
@@ -45,6 +45,19 @@ CmdBoardNetPointRemove::~CmdBoardNetPointRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetPointRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        size += sizeof(BI_NetPoint) + 512; // the removed netpoint and its graphics item
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +71,13 @@ bool CmdBoardNetPointRemove::performExecute() throw (Exception)
 
 void CmdBoardNetPointRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetPoint(mNetPoint); // can throw
 }
 
 void CmdBoardNetPointRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetPoint(mNetPoint); // can throw
 }
 
@@ -50,6 +50,11 @@ class CmdBoardNetPointRemove final : public UndoCommand
         explicit CmdBoardNetPointRemove(BI_NetPoint& netpoint) noexcept;
         ~CmdBoardNetPointRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
@@ -72,11 +72,13 @@ bool CmdBoardViaAdd::performExecute() throw (Exception)
 
 void CmdBoardViaAdd::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeVia(*mVia); // can throw
 }
 
 void CmdBoardViaAdd::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addVia(*mVia); // can throw
 }
 
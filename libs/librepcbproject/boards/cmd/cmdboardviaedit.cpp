@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdboardviaedit.h"
 #include "../items/bi_via.h"
+#include "../board.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -118,6 +119,7 @@ bool CmdBoardViaEdit::performExecute() throw (Exception)
 
 void CmdBoardViaEdit::performUndo() throw (Exception)
 {
+    mVia.getBoard().setModified();
     mVia.setNetSignal(mOldNetSignal); // can throw
     mVia.setPosition(mOldPos);
     mVia.setShape(mOldShape);
@@ -127,6 +129,7 @@ void CmdBoardViaEdit::performUndo() throw (Exception)
 
 void CmdBoardViaEdit::performRedo() throw (Exception)
 {
+    mVia.getBoard().setModified();
     mVia.setNetSignal(mNewNetSignal); // can throw
     mVia.setPosition(mNewPos);
     mVia.setShape(mNewShape);
@@ -45,6 +45,19 @@ CmdBoardViaRemove::~CmdBoardViaRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardViaRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        size += sizeof(BI_Via) + 1024; // the removed via and its graphics item
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +71,13 @@ bool CmdBoardViaRemove::performExecute() throw (Exception)
 
 void CmdBoardViaRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addVia(mVia); // can throw
 }
 
 void CmdBoardViaRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeVia(mVia); // can throw
 }
 
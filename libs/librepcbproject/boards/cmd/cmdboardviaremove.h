@@ -50,6 +50,11 @@ class CmdBoardViaRemove final : public UndoCommand
         explicit CmdBoardViaRemove(BI_Via& via) noexcept;
         ~CmdBoardViaRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
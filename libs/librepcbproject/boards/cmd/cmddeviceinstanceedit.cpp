@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmddeviceinstanceedit.h"
 #include "../items/bi_device.h"
+#include "../board.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -146,6 +147,7 @@ bool CmdDeviceInstanceEdit::performExecute() throw (Exception)
 
 void CmdDeviceInstanceEdit::performUndo() throw (Exception)
 {
+    mDevice.getBoard().setModified();
     mDevice.setIsMirrored(mOldMirrored); // can throw
     mDevice.setPosition(mOldPos);
     mDevice.setRotation(mOldRotation);
@@ -153,6 +155,7 @@ void CmdDeviceInstanceEdit::performUndo() throw (Exception)
 
 void CmdDeviceInstanceEdit::performRedo() throw (Exception)
 {
+    mDevice.getBoard().setModified();
     mDevice.setIsMirrored(mNewMirrored); // can throw
     mDevice.setPosition(mNewPos);
     mDevice.setRotation(mNewRotation);
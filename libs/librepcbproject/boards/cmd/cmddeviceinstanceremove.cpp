@@ -23,6 +23,8 @@
 #include <QtCore>
 #include "cmddeviceinstanceremove.h"
 #include "../items/bi_device.h"
+#include "../items/bi_footprint.h"
+#include "../items/bi_footprintpad.h"
 #include "../board.h"
 
 /*****************************************************************************************
@@ -45,6 +47,23 @@ CmdDeviceInstanceRemove::~CmdDeviceInstanceRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdDeviceInstanceRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        // the removed device is kept alive only by this command, including its
+        // footprint, all pads and their graphics items (with cached shapes)
+        qint64 padCount = mDevice.getFootprint().getPads().count();
+        size += sizeof(BI_Device) + sizeof(BI_Footprint) + 4096
+              + padCount * (sizeof(BI_FootprintPad) + 1024);
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +77,13 @@ bool CmdDeviceInstanceRemove::performExecute() throw (Exception)
 
 void CmdDeviceInstanceRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addDeviceInstance(mDevice); // can throw
 }
 
 void CmdDeviceInstanceRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeDeviceInstance(mDevice); // can throw
 }
 
@@ -50,6 +50,11 @@ class CmdDeviceInstanceRemove final : public UndoCommand
         CmdDeviceInstanceRemove(Board& board, BI_Device& dev) noexcept;
         ~CmdDeviceInstanceRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
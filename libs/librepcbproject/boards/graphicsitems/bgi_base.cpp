@@ -35,7 +35,8 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-BGI_Base::BGI_Base() noexcept
+BGI_Base::BGI_Base(BI_Base& boardItem) noexcept :
+    mBoardItem(boardItem)
 {
 
 }
@@ -34,6 +34,8 @@
 namespace librepcb {
 namespace project {
 
+class BI_Base;
+
 /*****************************************************************************************
  *  Class BGI_Base
  ****************************************************************************************/
@@ -46,9 +48,12 @@ class BGI_Base : public GraphicsItem
     public:
 
         // Constructors / Destructor
-        explicit BGI_Base() noexcept;
+        explicit BGI_Base(BI_Base& boardItem) noexcept;
         virtual ~BGI_Base() noexcept;
 
+        // Getters
+        BI_Base& getBoardItem() const noexcept {return mBoardItem;}
+
 
     protected:
 
@@ -61,6 +66,10 @@ class BGI_Base : public GraphicsItem
         //BGI_Base() = delete;
         BGI_Base(const BGI_Base& other) = delete;
         BGI_Base& operator=(const BGI_Base& rhs) = delete;
+
+
+        // Attributes
+        BI_Base& mBoardItem; ///< the board item this graphics item belongs to
 };
 
 /*****************************************************************************************
@@ -43,12 +43,20 @@ namespace project {
  ****************************************************************************************/
 
 BGI_Footprint::BGI_Footprint(BI_Footprint& footprint) noexcept :
-    BGI_Base(), mFootprint(footprint), mLibFootprint(footprint.getLibFootprint())
+    BGI_Base(footprint), mFootprint(footprint), mLibFootprint(footprint.getLibFootprint()),
+    mPrimitiveCache(PrimitivePathCache::getSharedCache(mLibFootprint))
 {
     mFont.setStyleStrategy(QFont::StyleStrategy(QFont::OpenGLCompatible | QFont::PreferQuality));
     mFont.setStyleHint(QFont::SansSerif);
     mFont.setFamily("Nimbus Sans L");
 
+    // parse all texts only once
+    for (int i = 0; i < mLibFootprint.getTextCount(); i++) {
+        const Text* text = mLibFootprint.getText(i);
+        Q_ASSERT(text); if (!text) continue;
+        mTextTemplates.insert(text, AttributeTextTemplate(text->getText()));
+    }
+
     updateCacheAndRepaint();
 }
 
@@ -125,9 +133,10 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         // create static text properties
         CachedTextProperties_t props;
 
-        // get the text to display
-        props.text = text->getText();
-        mFootprint.replaceVariablesWithAttributes(props.text, true);
+        // get the text to display (only rebuilt if a referenced attribute has changed)
+        AttributeTextTemplate& textTemplate = mTextTemplates[text];
+        textTemplate.update(mFootprint, true);
+        props.text = textTemplate.getText();
 
         // calculate font metrics
         props.fontPixelSize = qCeil(text->getHeight().toPx());
@@ -187,62 +196,40 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     const bool selected = mFootprint.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
-
-    // draw all polygons
-    for (int i = 0; i < mLibFootprint.getPolygonCount(); i++) {
-        const Polygon* polygon = mLibFootprint.getPolygon(i);
-        Q_ASSERT(polygon); if (!polygon) continue;
-
-        // get layer
-        layer = getBoardLayer(polygon->getLayerId());
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
-
-        // set pen
-        if (polygon->getLineWidth() > 0)
-            painter->setPen(QPen(layer->getColor(selected), polygon->getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-        else
-            painter->setPen(Qt::NoPen);
-
-        // set brush
-        if (!polygon->isFilled()) {
-            if (polygon->isGrabArea())
-                layer = getBoardLayer(BoardLayer::LayerID::TopDeviceGrabAreas);
-            else
-                layer = nullptr;
-        }
-        if (layer) {
-            if (layer->isVisible())
-                painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-            else
-                painter->setBrush(Qt::NoBrush);
-        } else {
+    const LodThresholds_t& lodThresholds = getLodThresholds();
+
+    // draw only the bounding rect if the footprint is too small to see any details
+    if ((!deviceIsPrinter) && (lod * qMax(mBoundingRect.width(), mBoundingRect.height())
+                               < lodThresholds.itemSize))
+    {
+        foreach (const PrimitivePathCache::Group_t& group, mPrimitiveCache->getGroups()) {
+            layer = getBoardLayer(group.layerId);
+            if (!layer) continue;
+            if (!layer->isVisible()) continue;
+            painter->setPen(QPen(layer->getColor(selected), 0));
             painter->setBrush(Qt::NoBrush);
+            painter->drawRect(mBoundingRect);
+            break;
         }
-
-        // draw polygon
-        painter->drawPath(polygon->toQPainterPathPx());
+        return;
     }
 
-    // draw all ellipses
-    for (int i = 0; i < mLibFootprint.getEllipseCount(); i++) {
-        const Ellipse* ellipse = mLibFootprint.getEllipse(i);
-        Q_ASSERT(ellipse); if (!ellipse) continue;
-
+    // draw all polygons and ellipses
+    foreach (const PrimitivePathCache::Group_t& group, mPrimitiveCache->getGroups()) {
         // get layer
-        layer = getBoardLayer(ellipse->getLayerId());
+        layer = getBoardLayer(group.layerId);
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
         // set pen
-        if (ellipse->getLineWidth() > 0)
-            painter->setPen(QPen(layer->getColor(selected), ellipse->getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+        if (group.lineWidth > 0)
+            painter->setPen(QPen(layer->getColor(selected), group.lineWidth.toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
         else
             painter->setPen(Qt::NoPen);
 
         // set brush
-        if (!ellipse->isFilled()) {
-            if (ellipse->isGrabArea())
+        if (!group.isFilled) {
+            if (group.isGrabArea)
                 layer = getBoardLayer(BoardLayer::LayerID::TopDeviceGrabAreas);
             else
                 layer = nullptr;
@@ -256,10 +243,8 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
             painter->setBrush(Qt::NoBrush);
         }
 
-        // draw ellipse
-        painter->drawEllipse(ellipse->getCenter().toPxQPointF(), ellipse->getRadiusX().toPx(),
-                             ellipse->getRadiusY().toPx());
-        // TODO: rotation
+        // draw polygons/ellipses
+        painter->drawPath(group.path);
     }
 
     // draw all texts
@@ -283,7 +268,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         painter->translate(-text->getPosition().toPxQPointF());
         painter->scale(props.scaleFactor, props.scaleFactor);
         if (props.rotate180) painter->rotate(180);
-        if ((deviceIsPrinter) || (lod * text->getHeight().toPx() > 8))
+        if ((deviceIsPrinter) || (lod * text->getHeight().toPx() >= lodThresholds.textHeight))
         {
             // draw text
             painter->setPen(QPen(layer->getColor(selected), 0));
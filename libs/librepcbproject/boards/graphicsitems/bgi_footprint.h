@@ -26,6 +26,8 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "bgi_base.h"
+#include <librepcbcommon/attributetexttemplate.h>
+#include <librepcbcommon/graphics/primitivepathcache.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -99,12 +101,14 @@ class BGI_Footprint final : public BGI_Base
         // General Attributes
         BI_Footprint& mFootprint;
         const library::Footprint& mLibFootprint;
+        QSharedPointer<const PrimitivePathCache> mPrimitiveCache; ///< shared by all instances
         QFont mFont;
 
         // Cached Attributes
         QRectF mBoundingRect;
         QPainterPath mShape;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+        QHash<const Text*, AttributeTextTemplate> mTextTemplates;
 };
 
 /*****************************************************************************************
@@ -48,7 +48,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_FootprintPad::BGI_FootprintPad(BI_FootprintPad& pad) noexcept :
-    BGI_Base(), mPad(pad), mLibPad(pad.getLibPad()), mPadLayer(nullptr),
+    BGI_Base(pad), mPad(pad), mLibPad(pad.getLibPad()), mPadLayer(nullptr),
     mTopStopMaskLayer(nullptr), mBottomStopMaskLayer(nullptr),
     mTopCreamMaskLayer(nullptr), mBottomCreamMaskLayer(nullptr)
 {
@@ -139,14 +139,25 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 
 void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
-    //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
-    //const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const LodThresholds_t& lodThresholds = getLodThresholds();
 
     const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
     bool highlight = mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    // draw only a filled rect (without masks and text) if the pad is too small
+    const QRectF padRect = mLibPad.getBoundingRectPx();
+    if ((!deviceIsPrinter) && (lod * qMax(padRect.width(), padRect.height())
+                               < lodThresholds.padSize))
+    {
+        if (mPadLayer && mPadLayer->isVisible()) {
+            painter->fillRect(padRect, mPadLayer->getColor(highlight));
+        }
+        return;
+    }
+
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
@@ -167,9 +178,11 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
         painter->setBrush(mPadLayer->getColor(highlight));
         painter->drawPath(mLibPad.toQPainterPathPx());
         // draw pad text
-        painter->setFont(mFont);
-        painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-        painter->drawText(mLibPad.getBoundingRectPx(), Qt::AlignCenter, mPad.getDisplayText());
+        if ((deviceIsPrinter) || (lod * mFont.pixelSize() >= lodThresholds.textHeight)) {
+            painter->setFont(mFont);
+            painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+            painter->drawText(padRect, Qt::AlignCenter, mPad.getDisplayText());
+        }
     }
 
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
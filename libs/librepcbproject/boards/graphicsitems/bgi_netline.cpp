@@ -43,7 +43,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_NetLine::BGI_NetLine(BI_NetLine& netline) noexcept :
-    BGI_Base(), mNetLine(netline), mLayer(nullptr)
+    BGI_Base(netline), mNetLine(netline), mLayer(nullptr)
 {
     updateCacheAndRepaint();
 }
@@ -97,15 +97,18 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
 
 void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
     bool highlight = mNetLine.isSelected() || mNetLine.getNetSignal().isHighlighted();
 
-    // draw line
+    // draw line (as cosmetic hairline if it is too thin to see its width anyway)
     if (mLayer->isVisible())
     {
-        QPen pen(mLayer->getColor(highlight), mNetLine.getWidth().toPx(), Qt::SolidLine, Qt::RoundCap);
+        qreal width = mNetLine.getWidth().toPx();
+        if ((!deviceIsPrinter) && (lod * width < getLodThresholds().lineWidth)) width = 0;
+        QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
         painter->setPen(pen);
         painter->drawLine(mLineF);
     }
@@ -33,12 +33,19 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+quint64 BI_Base::sAddedCounter = 0;
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 BI_Base::BI_Base(Board& board) noexcept :
-    QObject(&board), mBoard(board), mIsAddedToBoard(false), mIsSelected(false)
+    QObject(&board), mBoard(board), mIsAddedToBoard(false), mIsSelected(false),
+    mAddedOrder(0)
 {
 }
 
@@ -78,6 +85,7 @@ void BI_Base::addToBoard() noexcept
 {
     Q_ASSERT(!mIsAddedToBoard);
     mIsAddedToBoard = true;
+    mAddedOrder = ++sAddedCounter;
 }
 
 void BI_Base::removeFromBoard() noexcept
@@ -91,6 +99,7 @@ void BI_Base::addToBoard(GraphicsScene& scene, BGI_Base& item) noexcept
     Q_ASSERT(!mIsAddedToBoard);
     scene.addItem(item);
     mIsAddedToBoard = true;
+    mAddedOrder = ++sAddedCounter;
 }
 
 void BI_Base::removeFromBoard(GraphicsScene& scene, BGI_Base& item) noexcept
@@ -83,6 +83,14 @@ class BI_Base : public QObject
         virtual bool isSelectable() const noexcept = 0;
         virtual bool isSelected() const noexcept {return mIsSelected;}
 
+        /**
+         * @brief Get the order in which the items were added to the board
+         *
+         * Items which were added later have a higher number. This allows to sort items
+         * in the same order as the item lists of the board, without searching them.
+         */
+        quint64 getAddedOrder() const noexcept {return mAddedOrder;}
+
         // Setters
         virtual void setSelected(bool selected) noexcept;
 
@@ -113,6 +121,10 @@ class BI_Base : public QObject
         // General Attributes
         bool mIsAddedToBoard;
         bool mIsSelected;
+        quint64 mAddedOrder; ///< see #getAddedOrder()
+
+        // Static Variables
+        static quint64 sAddedCounter; ///< the last assigned #mAddedOrder
 };
 
 /*****************************************************************************************
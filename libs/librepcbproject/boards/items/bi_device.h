@@ -115,7 +115,7 @@ class BI_Device final : public BI_Base, public IF_AttributeProvider,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
         void moved(const Point& newPos);
         void rotated(const Angle& newRotation);
@@ -131,7 +131,7 @@ class BI_Device final : public BI_Base, public IF_AttributeProvider,
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
         // General
@@ -250,7 +250,7 @@ void BI_Footprint::deviceInstanceAttributesChanged()
 void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
     mGraphicsItem->setPos(pos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -260,7 +260,7 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 {
     Q_UNUSED(rot);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -270,7 +270,7 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
 {
     Q_UNUSED(mirrored);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
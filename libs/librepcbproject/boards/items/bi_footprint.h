@@ -113,7 +113,7 @@ class BI_Footprint final : public BI_Base, public IF_XmlSerializableObject,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
 
     private:
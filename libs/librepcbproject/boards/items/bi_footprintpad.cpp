@@ -187,7 +187,7 @@ void BI_FootprintPad::updatePosition() noexcept
     mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
     mGraphicsItem->setPos(mPosition.toPxQPointF());
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
@@ -201,7 +201,7 @@ void BI_NetLine::removeFromBoard(GraphicsScene& scene) throw (Exception)
 void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
 }
 
 XmlDomElement* BI_NetLine::serializeToXmlDomElement() const throw (Exception)
@@ -259,6 +259,7 @@ void BI_NetPoint::setPadToAttach(BI_FootprintPad* pad) throw (Exception)
     }
     mFootprintPad = pad;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.invalidateConnectivity();
 }
 
 void BI_NetPoint::setViaToAttach(BI_Via* via) throw (Exception)
@@ -287,6 +288,7 @@ void BI_NetPoint::setViaToAttach(BI_Via* via) throw (Exception)
     }
     mVia = via;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.invalidateConnectivity();
 }
 
 void BI_NetPoint::setPosition(const Point& position) noexcept
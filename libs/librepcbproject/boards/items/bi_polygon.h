@@ -100,7 +100,7 @@ class BI_Polygon final : public BI_Base, public IF_XmlSerializableObject,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
 
     private:
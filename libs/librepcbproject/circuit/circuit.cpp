@@ -45,7 +45,8 @@ namespace project {
 
 Circuit::Circuit(Project& project, bool restore, bool readOnly, bool create) throw (Exception) :
     QObject(&project), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/circuit.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/circuit.xml")), mXmlFile(nullptr),
+    mRevision(1)
 {
     qDebug() << "load circuit...";
     Q_ASSERT(!(create && (restore || readOnly)));
@@ -367,16 +368,20 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp, const QString& ne
  *  General Methods
  ****************************************************************************************/
 
-bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
+bool Circuit::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
     // Save "core/circuit.xml"
     try
     {
-        XmlDomDocument doc(*serializeToXmlDomElement());
-        doc.setFileVersion(APP_VERSION_MAJOR);
-        mXmlFile->save(doc, toOriginal);
+        if (!mXmlFile->tryUpdateToRevision(mRevision, toOriginal))
+        {
+            // the content was modified since the file was written the last time
+            QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+            doc->setFileVersion(APP_VERSION_MAJOR);
+            mXmlFile->save(doc, toOriginal, mRevision, writer);
+        }
     }
     catch (Exception& e)
     {
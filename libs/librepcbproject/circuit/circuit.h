@@ -35,6 +35,7 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartXmlFileWriter;
 
 namespace library {
 class Component;
@@ -111,7 +112,8 @@ class Circuit final : public QObject, public IF_XmlSerializableObject
         void setComponentInstanceName(ComponentInstance& cmp, const QString& newName) throw (Exception);
 
         // General Methods
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        void setModified() noexcept {++mRevision;}
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer = nullptr) noexcept;
 
         // Operator Overloadings
         Circuit& operator=(const Circuit& rhs) = delete;
@@ -144,6 +146,7 @@ class Circuit final : public QObject, public IF_XmlSerializableObject
         // File "core/circuit.xml"
         FilePath mXmlFilepath;
         SmartXmlFile* mXmlFile;
+        quint64 mRevision; ///< incremented on every modification, see #setModified()
 
         QMap<Uuid, NetClass*> mNetClasses;
         QMap<Uuid, NetSignal*> mNetSignals;
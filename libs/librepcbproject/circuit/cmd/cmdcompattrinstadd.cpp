@@ -24,6 +24,7 @@
 #include "cmdcompattrinstadd.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
+#include "../circuit.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -63,11 +64,13 @@ bool CmdCompAttrInstAdd::performExecute() throw (Exception)
 
 void CmdCompAttrInstAdd::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.removeAttribute(*mAttrInstance); // can throw
 }
 
 void CmdCompAttrInstAdd::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.addAttribute(*mAttrInstance); // can throw
 }
 
@@ -24,6 +24,7 @@
 #include "cmdcompattrinstedit.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
+#include "../circuit.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -63,14 +64,16 @@ bool CmdCompAttrInstEdit::performExecute() throw (Exception)
 
 void CmdCompAttrInstEdit::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mAttrInst.setTypeValueUnit(*mOldType, mOldValue, mOldUnit); // can throw
-    emit mComponentInstance.attributesChanged();
+    emit mComponentInstance.attributesChanged(mAttrInst.getKey());
 }
 
 void CmdCompAttrInstEdit::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mAttrInst.setTypeValueUnit(*mNewType, mNewValue, mNewUnit); // can throw
-    emit mComponentInstance.attributesChanged();
+    emit mComponentInstance.attributesChanged(mAttrInst.getKey());
 }
 
 /*****************************************************************************************
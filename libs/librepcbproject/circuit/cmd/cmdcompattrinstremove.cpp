@@ -24,6 +24,7 @@
 #include "cmdcompattrinstremove.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
+#include "../circuit.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -59,11 +60,13 @@ bool CmdCompAttrInstRemove::performExecute() throw (Exception)
 
 void CmdCompAttrInstRemove::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.addAttribute(mAttrInstance); // can throw
 }
 
 void CmdCompAttrInstRemove::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.removeAttribute(mAttrInstance); // can throw
 }
 
@@ -73,11 +73,13 @@ bool CmdComponentInstanceAdd::performExecute() throw (Exception)
 
 void CmdComponentInstanceAdd::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeComponentInstance(*mComponentInstance); // can throw
 }
 
 void CmdComponentInstanceAdd::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addComponentInstance(*mComponentInstance); // can throw
 }
 
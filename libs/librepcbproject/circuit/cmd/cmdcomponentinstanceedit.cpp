@@ -75,12 +75,14 @@ bool CmdComponentInstanceEdit::performExecute() throw (Exception)
 
 void CmdComponentInstanceEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setComponentInstanceName(mComponentInstance, mOldName); // can throw
     mComponentInstance.setValue(mOldValue);
 }
 
 void CmdComponentInstanceEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setComponentInstanceName(mComponentInstance, mNewName); // can throw
     mComponentInstance.setValue(mNewValue);
 }
@@ -59,11 +59,13 @@ bool CmdComponentInstanceRemove::performExecute() throw (Exception)
 
 void CmdComponentInstanceRemove::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addComponentInstance(mComponentInstance); // can throw
 }
 
 void CmdComponentInstanceRemove::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeComponentInstance(mComponentInstance); // can throw
 }
 
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdcompsiginstsetnetsignal.h"
 #include "../componentsignalinstance.h"
+#include "../circuit.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -59,11 +60,13 @@ bool CmdCompSigInstSetNetSignal::performExecute() throw (Exception)
 
 void CmdCompSigInstSetNetSignal::performUndo() throw (Exception)
 {
+    mComponentSignalInstance.getCircuit().setModified();
     mComponentSignalInstance.setNetSignal(mOldNetSignal); // can throw
 }
 
 void CmdCompSigInstSetNetSignal::performRedo() throw (Exception)
 {
+    mComponentSignalInstance.getCircuit().setModified();
     mComponentSignalInstance.setNetSignal(mNetSignal); // can throw
 }
 
@@ -60,11 +60,13 @@ bool CmdNetClassAdd::performExecute() throw (Exception)
 
 void CmdNetClassAdd::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeNetClass(*mNetClass); // can throw
 }
 
 void CmdNetClassAdd::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addNetClass(*mNetClass); // can throw
 }
 
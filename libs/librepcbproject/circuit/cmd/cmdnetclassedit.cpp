@@ -68,11 +68,13 @@ bool CmdNetClassEdit::performExecute() throw (Exception)
 
 void CmdNetClassEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetClassName(mNetClass, mOldName); // can throw
 }
 
 void CmdNetClassEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetClassName(mNetClass, mNewName); // can throw
 }
 
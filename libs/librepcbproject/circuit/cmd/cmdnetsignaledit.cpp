@@ -70,11 +70,13 @@ bool CmdNetSignalEdit::performExecute() throw (Exception)
 
 void CmdNetSignalEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetSignalName(mNetSignal, mOldName, mOldIsAutoName); // can throw
 }
 
 void CmdNetSignalEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetSignalName(mNetSignal, mNewName, mNewIsAutoName); // can throw
 }
 
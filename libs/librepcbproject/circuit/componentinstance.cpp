@@ -30,6 +30,7 @@
 #include "componentsignalinstance.h"
 #include <librepcblibrary/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "componentattributeinstance.h"
 #include <librepcbcommon/fileio/xmldomelement.h>
 #include "../settings/projectsettings.h"
@@ -248,7 +249,7 @@ void ComponentInstance::setName(const QString& name) throw (Exception)
         }
         mName = name;
         updateErcMessages();
-        emit attributesChanged();
+        emit attributesChanged("NAME");
     }
 }
 
@@ -256,7 +257,7 @@ void ComponentInstance::setValue(const QString& value) noexcept
 {
     if (value != mValue) {
         mValue = value;
-        emit attributesChanged();
+        emit attributesChanged("VALUE");
     }
 }
 
@@ -285,7 +286,7 @@ void ComponentInstance::addAttribute(ComponentAttributeInstance& attr) throw (Ex
             "key \"%2\".")).arg(mName, attr.getKey()));
     }
     mAttributes.append(&attr);
-    emit attributesChanged();
+    emit attributesChanged(attr.getKey());
 }
 
 void ComponentInstance::removeAttribute(ComponentAttributeInstance& attr) throw (Exception)
@@ -294,7 +295,7 @@ void ComponentInstance::removeAttribute(ComponentAttributeInstance& attr) throw
         throw LogicError(__FILE__, __LINE__);
     }
     mAttributes.removeOne(&attr);
-    emit attributesChanged();
+    emit attributesChanged(attr.getKey());
 }
 
 /*****************************************************************************************
@@ -442,6 +443,10 @@ bool ComponentInstance::checkAttributesValidity() const noexcept
 
 void ComponentInstance::updateErcMessages() noexcept
 {
+    if (mCircuit.getProject().getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     int required = getUnplacedRequiredSymbolsCount();
     int optional = getUnplacedOptionalSymbolsCount();
     mErcMsgUnplacedRequiredSymbols->setMsg(
@@ -148,7 +148,7 @@ class ComponentInstance : public QObject, public IF_AttributeProvider,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
 
     private:
@@ -158,7 +158,7 @@ class ComponentInstance : public QObject, public IF_AttributeProvider,
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
         // General
@@ -29,11 +29,13 @@
 #include "netsignal.h"
 #include <librepcblibrary/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include <librepcbcommon/fileio/xmldomelement.h>
 #include "../project.h"
 #include "../settings/projectsettings.h"
 #include "../schematics/items/si_symbolpin.h"
 #include "../boards/items/bi_footprintpad.h"
+#include "../boards/board.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -183,6 +185,9 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) throw (Exceptio
                       this, &ComponentSignalInstance::netSignalNameChanged);});
     }
     mNetSignal = netsignal;
+    // the pads now belong to another netsignal, so its routing state has changed
+    foreach (BI_FootprintPad* pad, mRegisteredFootprintPads)
+        pad->getBoard().invalidateConnectivity();
     updateErcMessages();
     sgl.dismiss();
 }
@@ -288,6 +293,10 @@ void ComponentSignalInstance::netSignalNameChanged(const QString& newName) noexc
 
 void ComponentSignalInstance::updateErcMessages() noexcept
 {
+    if (mCircuit.getProject().getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     mErcMsgUnconnectedRequiredSignal->setMsg(
         QString(tr("Unconnected component signal: \"%1\" from \"%2\""))
         .arg(mComponentSignal->getName()).arg(mComponentInstance.getName()));
@@ -119,7 +119,7 @@ class ComponentSignalInstance final : public QObject, public IF_ErcMsgProvider,
     private slots:
 
         void netSignalNameChanged(const QString& newName) noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
     private:
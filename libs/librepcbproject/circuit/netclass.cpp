@@ -26,6 +26,8 @@
 #include "netsignal.h"
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include <librepcbcommon/fileio/xmldomelement.h>
 
 /*****************************************************************************************
@@ -152,6 +154,10 @@ bool NetClass::checkAttributesValidity() const noexcept
 
 void NetClass::updateErcMessages() noexcept
 {
+    if (mCircuit.getProject().getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     if (mIsAddedToCircuit && (!isUsed())) {
         if (!mErcMsgUnusedNetClass) {
             mErcMsgUnusedNetClass.reset(new ErcMsg(mCircuit.getProject(), *this,
@@ -89,7 +89,7 @@ class NetClass final : public QObject, public IF_ErcMsgProvider,
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
         // General
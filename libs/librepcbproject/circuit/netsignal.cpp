@@ -26,6 +26,8 @@
 #include <librepcbcommon/exceptions.h>
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "componentsignalinstance.h"
 #include <librepcbcommon/fileio/xmldomelement.h>
 #include "../schematics/items/si_netlabel.h"
@@ -286,6 +288,10 @@ bool NetSignal::checkAttributesValidity() const noexcept
 
 void NetSignal::updateErcMessages() noexcept
 {
+    if (mCircuit.getProject().getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     if (mIsAddedToCircuit && (!isUsed())) {
         if (!mErcMsgUnusedNetSignal) {
             mErcMsgUnusedNetSignal.reset(new ErcMsg(mCircuit.getProject(), *this,
@@ -120,7 +120,7 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public IF_XmlS
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
         // General
@@ -53,7 +53,7 @@ class ErcMsg
             SchematicError,     ///< example: unplaced required symbols
             SchematicWarning,   ///< example: unplaced optional symbols
             BoardError,         ///< example: unplaced footprints
-            BoardWarning,       ///< example: ???
+            BoardWarning,       ///< example: not fully routed net signals
             _Count              ///< count of message types
         };
 
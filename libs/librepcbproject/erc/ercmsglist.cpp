@@ -41,7 +41,8 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool create) throw (Exception) :
     QObject(&project), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr),
+    mRevision(1), mBatchNestingDepth(0), mIsPerformingDeferredUpdates(false)
 {
     try
     {
@@ -63,7 +64,10 @@ ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool creat
 
 ErcMsgList::~ErcMsgList() noexcept
 {
+    Q_ASSERT(mBatchNestingDepth == 0);
+    Q_ASSERT(mDeferredUpdates.isEmpty());
     Q_ASSERT(mItems.isEmpty());
+    Q_ASSERT(mItemIndices.isEmpty());
     delete mXmlFile;            mXmlFile = nullptr;
 }
 
@@ -74,27 +78,71 @@ ErcMsgList::~ErcMsgList() noexcept
 void ErcMsgList::add(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(!mItems.contains(ercMsg));
+    Q_ASSERT(!mItemIndices.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
+    ++mRevision;
+    mItemIndices.insert(ercMsg, mItems.count());
     mItems.append(ercMsg);
-    emit ercMsgAdded(ercMsg);
+    if (isBatchActive()) {
+        mBatchChanges.add(ercMsg);
+    } else {
+        emit ercMsgAdded(ercMsg);
+    }
 }
 
 void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(mItemIndices.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
-    mItems.removeOne(ercMsg);
-    emit ercMsgRemoved(ercMsg);
+    ++mRevision;
+    // move the last message to the index of the removed one to remove it in O(1) (the
+    // message may be deleted right after this call, so it must not stay in the list)
+    int index = mItemIndices.take(ercMsg);
+    ErcMsg* last = mItems.takeLast();
+    if (last != ercMsg) {
+        mItems[index] = last;
+        mItemIndices[last] = index;
+    }
+    if (isBatchActive()) {
+        mBatchChanges.remove(ercMsg);
+    } else {
+        emit ercMsgRemoved(ercMsg);
+    }
 }
 
 void ErcMsgList::update(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(mItemIndices.contains(ercMsg));
     Q_ASSERT(ercMsg->isVisible());
-    emit ercMsgChanged(ercMsg);
+    ++mRevision;
+    if (isBatchActive()) {
+        mBatchChanges.update(ercMsg);
+    } else {
+        emit ercMsgChanged(ercMsg);
+    }
+}
+
+bool ErcMsgList::deferUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if ((!isBatchActive()) || mIsPerformingDeferredUpdates) {
+        return false;
+    }
+    if (!provider.mErcMsgListWithPendingUpdate) {
+        provider.mErcMsgListWithPendingUpdate = this;
+        mDeferredUpdates.append(&provider);
+    }
+    Q_ASSERT(provider.mErcMsgListWithPendingUpdate == this);
+    return true;
+}
+
+void ErcMsgList::cancelDeferredUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if (provider.mErcMsgListWithPendingUpdate == this) {
+        mDeferredUpdates.removeOne(&provider);
+        provider.mErcMsgListWithPendingUpdate = nullptr;
+    }
 }
 
 void ErcMsgList::restoreIgnoreState() noexcept
@@ -124,16 +172,20 @@ void ErcMsgList::restoreIgnoreState() noexcept
     }
 }
 
-bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
+bool ErcMsgList::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
     // Save "core/erc.xml"
     try
     {
-        XmlDomDocument doc(*serializeToXmlDomElement());
-        doc.setFileVersion(APP_VERSION_MAJOR);
-        mXmlFile->save(doc, toOriginal);
+        if (!mXmlFile->tryUpdateToRevision(mRevision, toOriginal))
+        {
+            // the content was modified since the file was written the last time
+            QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+            doc->setFileVersion(APP_VERSION_MAJOR);
+            mXmlFile->save(doc, toOriginal, mRevision, writer);
+        }
     }
     catch (Exception& e)
     {
@@ -144,6 +196,42 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+/*****************************************************************************************
+ *  Public Slots
+ ****************************************************************************************/
+
+void ErcMsgList::beginBatch() noexcept
+{
+    ++mBatchNestingDepth;
+}
+
+void ErcMsgList::endBatch() noexcept
+{
+    Q_ASSERT(mBatchNestingDepth > 0);
+    if (mBatchNestingDepth > 1) {
+        --mBatchNestingDepth;
+        return;
+    }
+
+    // recalculate the messages of all modified providers (still within the batch to
+    // collect all resulting changes)
+    mIsPerformingDeferredUpdates = true;
+    while (!mDeferredUpdates.isEmpty()) {
+        IF_ErcMsgProvider* provider = mDeferredUpdates.takeFirst();
+        provider->mErcMsgListWithPendingUpdate = nullptr;
+        provider->updateErcMessages();
+    }
+    mIsPerformingDeferredUpdates = false;
+    mBatchNestingDepth = 0;
+
+    // emit all changes at once
+    if (!mBatchChanges.isEmpty()) {
+        QList<ErcMsg*> added, removed, changed;
+        mBatchChanges.takeAll(added, removed, changed);
+        emit ercMsgsChanged(added, removed, changed);
+    }
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -159,16 +247,26 @@ XmlDomElement* ErcMsgList::serializeToXmlDomElement() const throw (Exception)
 
     QScopedPointer<XmlDomElement> root(new XmlDomElement("erc"));
     XmlDomElement* ignoreNode = root->appendChild("ignore");
+    // the messages are not ordered, so sort them to get a stable file content
+    QList<QStringList> ignoredItems;
     foreach (ErcMsg* ercMsg, mItems)
     {
         if (ercMsg->isIgnored())
         {
-            XmlDomElement* itemNode = ignoreNode->appendChild("item");
-            itemNode->setAttribute("owner_class", ercMsg->getOwner().getErcMsgOwnerClassName());
-            itemNode->setAttribute("owner_key", ercMsg->getOwnerKey());
-            itemNode->setAttribute("msg_key", ercMsg->getMsgKey());
+            ignoredItems.append(QStringList()
+                << QString(ercMsg->getOwner().getErcMsgOwnerClassName())
+                << ercMsg->getOwnerKey() << ercMsg->getMsgKey());
         }
     }
+    std::sort(ignoredItems.begin(), ignoredItems.end(),
+              [](const QStringList& a, const QStringList& b){return a.join("/") < b.join("/");});
+    foreach (const QStringList& item, ignoredItems)
+    {
+        XmlDomElement* itemNode = ignoreNode->appendChild("item");
+        itemNode->setAttribute("owner_class", item.at(0));
+        itemNode->setAttribute("owner_key", item.at(1));
+        itemNode->setAttribute("msg_key", item.at(2));
+    }
     return root.take();
 }
 
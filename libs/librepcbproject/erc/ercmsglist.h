@@ -27,6 +27,7 @@
 #include <librepcbcommon/fileio/if_xmlserializableobject.h>
 #include <librepcbcommon/exceptions.h>
 #include <librepcbcommon/fileio/filepath.h>
+#include <librepcbcommon/batchedchanges.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -34,11 +35,13 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartXmlFileWriter;
 
 namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*****************************************************************************************
  *  Class ErcMsgList
@@ -46,6 +49,14 @@ class ErcMsg;
 
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible for the user
+ *
+ * Big modifications of a project (e.g. executing or undoing a command of the undo stack)
+ * can change a lot of ERC messages. To avoid recalculating them again and again, these
+ * modifications are enclosed in #beginBatch() and #endBatch(). Within a batch, the list
+ * does not emit the signals for each single message, and providers which have called
+ * #deferUpdate() recalculate their messages only once at the end of the batch. Then a
+ * single #ercMsgsChanged() signal is emitted with all changes of the batch. The list
+ * itself is always kept up to date, so it can be read (and saved) at any time.
  */
 class ErcMsgList final : public QObject, public IF_XmlSerializableObject
 {
@@ -58,14 +69,60 @@ class ErcMsgList final : public QObject, public IF_XmlSerializableObject
         ~ErcMsgList() noexcept;
 
         // Getters
+
+        /**
+         * @brief Get all visible ERC messages (in no specific order)
+         *
+         * @note The list is always up to date, also while a batch is active (only the
+         *       signals are deferred to the end of the batch).
+         */
         const QList<ErcMsg*>& getItems() const noexcept {return mItems;}
 
+        bool isBatchActive() const noexcept {return mBatchNestingDepth > 0;}
+
         // General Methods
         void add(ErcMsg* ercMsg) noexcept;
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
+
+        /**
+         * @brief Defer the recalculation of the ERC messages of a provider
+         *
+         * @param provider  The provider which wants to recalculate its messages
+         *
+         * @retval true     A batch is active and IF_ErcMsgProvider#updateErcMessages()
+         *                  will be called at the end of the batch (only once)
+         * @retval false    No batch is active, the provider must recalculate its
+         *                  messages immediately
+         */
+        bool deferUpdate(IF_ErcMsgProvider& provider) noexcept;
+
+        /**
+         * @brief Remove a provider from the list of deferred updates (see #deferUpdate())
+         *
+         * @note This is called automatically when the provider is destroyed.
+         */
+        void cancelDeferredUpdate(IF_ErcMsgProvider& provider) noexcept;
+
         void restoreIgnoreState() noexcept;
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer = nullptr) noexcept;
+
+
+    public slots:
+
+        /**
+         * @brief Begin a batch of modifications (can be nested)
+         */
+        void beginBatch() noexcept;
+
+        /**
+         * @brief End a batch of modifications
+         *
+         * If the outermost batch is ended, all deferred updates are performed and the
+         * signal #ercMsgsChanged() is emitted (if there were any changes).
+         */
+        void endBatch() noexcept;
+
 
     signals:
 
@@ -73,6 +130,18 @@ class ErcMsgList final : public QObject, public IF_XmlSerializableObject
         void ercMsgRemoved(ErcMsg* ercMsg);
         void ercMsgChanged(ErcMsg* ercMsg);
 
+        /**
+         * @brief All changes of a batch (see #beginBatch() and #endBatch())
+         *
+         * @param added     Messages which were added to the list
+         * @param removed   Messages which were removed from the list. Attention: These
+         *                  objects may already be deleted, so they must not be
+         *                  dereferenced!
+         * @param changed   Messages which were modified (or removed and added again)
+         */
+        void ercMsgsChanged(const QList<ErcMsg*>& added, const QList<ErcMsg*>& removed,
+                            const QList<ErcMsg*>& changed);
+
 
     private:
 
@@ -96,9 +165,17 @@ class ErcMsgList final : public QObject, public IF_XmlSerializableObject
         // File "core/erc.xml"
         FilePath mXmlFilepath;
         SmartXmlFile* mXmlFile;
+        quint64 mRevision; ///< incremented on every modification of the list
 
         // Misc
-        QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+        QList<ErcMsg*> mItems; ///< contains all visible ERC messages (in no specific order)
+        QHash<ErcMsg*, int> mItemIndices; ///< the index of each message in #mItems
+
+        // Batch
+        int mBatchNestingDepth;
+        bool mIsPerformingDeferredUpdates;
+        QList<IF_ErcMsgProvider*> mDeferredUpdates;
+        BatchedChanges<ErcMsg*> mBatchChanges; ///< changes to emit at the end of the batch
 };
 
 /*****************************************************************************************
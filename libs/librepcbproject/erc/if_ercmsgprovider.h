@@ -27,6 +27,7 @@ namespace librepcb {
 namespace project {
 
 class ErcMsg; // all classes which implement IF_ErcMsgProvider will need this declaration
+class ErcMsgList;
 
 /*****************************************************************************************
  *  Macros
@@ -55,14 +56,35 @@ private:
  */
 class IF_ErcMsgProvider
 {
+        friend class ErcMsgList;
+
     public:
 
         // Constructors / Destructor
-        IF_ErcMsgProvider() {}
-        virtual ~IF_ErcMsgProvider() {}
+        IF_ErcMsgProvider() : mErcMsgListWithPendingUpdate(nullptr) {}
+        virtual ~IF_ErcMsgProvider();
 
         // Getters
         virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+
+    protected:
+
+        /**
+         * @brief Recalculate all ERC messages of this object
+         *
+         * Providers with expensive calculations should call ErcMsgList#deferUpdate() at
+         * the beginning of this method and return immediately if it returns true. The
+         * #ErcMsgList will then call this method again at the end of the current batch
+         * (see ErcMsgList#beginBatch()), only once per object.
+         */
+        virtual void updateErcMessages() noexcept {}
+
+
+    private:
+
+        /// @brief The ERC message list which will call #updateErcMessages() (if any)
+        ErcMsgList* mErcMsgListWithPendingUpdate;
 };
 
 /*****************************************************************************************
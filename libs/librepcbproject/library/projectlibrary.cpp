@@ -21,7 +21,9 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent>
 #include <librepcbcommon/exceptions.h>
+#include <librepcbcommon/scopeguard.h>
 #include "projectlibrary.h"
 #include <librepcbcommon/fileio/filepath.h>
 #include "../project.h"
@@ -44,9 +46,10 @@ using namespace library;
  *  Constructors / Destructor
  ****************************************************************************************/
 
-ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) throw (Exception) :
+ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly,
+                               bool lazy) throw (Exception) :
     QObject(&project), mProject(project),
-    mLibraryPath(project.getPath().getPathTo("library"))
+    mLibraryPath(project.getPath().getPathTo("library")), mPrefetchAborted(0)
 {
     qDebug() << "load project library...";
 
@@ -61,14 +64,27 @@ ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) th
         }
     }
 
+    // Index all library elements (cheap, no files are parsed)
+    indexElements(mLibraryPath.getPathTo("sym"),    "symbols",      mUnloadedSymbols);
+    indexElements(mLibraryPath.getPathTo("spcmdl"), "spice models", mUnloadedSpiceModels);
+    indexElements(mLibraryPath.getPathTo("pkg"),    "packages",     mUnloadedPackages);
+    indexElements(mLibraryPath.getPathTo("cmp"),    "components",   mUnloadedComponents);
+    indexElements(mLibraryPath.getPathTo("dev"),    "devices",      mUnloadedDevices);
+
+    if (lazy)
+    {
+        qDebug() << "project library successfully indexed!";
+        return; // the elements will be loaded on demand
+    }
+
     try
     {
         // Load all library elements
-        loadElements<Symbol>    (mLibraryPath.getPathTo("sym"),    "symbols",      mSymbols);
-        loadElements<SpiceModel>(mLibraryPath.getPathTo("spcmdl"), "spice models", mSpiceModels);
-        loadElements<Package>   (mLibraryPath.getPathTo("pkg"),    "packages",     mPackages);
-        loadElements<Component> (mLibraryPath.getPathTo("cmp"),    "components",   mComponents);
-        loadElements<Device>    (mLibraryPath.getPathTo("dev"),    "devices",      mDevices);
+        loadElements<Symbol>    (mSymbols,     mUnloadedSymbols);
+        loadElements<SpiceModel>(mSpiceModels, mUnloadedSpiceModels);
+        loadElements<Package>   (mPackages,    mUnloadedPackages);
+        loadElements<Component> (mComponents,  mUnloadedComponents);
+        loadElements<Device>    (mDevices,     mUnloadedDevices);
     }
     catch (Exception &e)
     {
@@ -86,6 +102,10 @@ ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) th
 
 ProjectLibrary::~ProjectLibrary() noexcept
 {
+    // stop the background prefetching (if running)
+    mPrefetchAborted.store(1);
+    mPrefetchFuture.waitForFinished();
+
     // clean up all removed elements
     cleanupElements<Symbol>(mAddedSymbols, mRemovedSymbols);
     cleanupElements<SpiceModel>(mAddedSpiceModels, mRemovedSpiceModels);
@@ -105,39 +125,64 @@ ProjectLibrary::~ProjectLibrary() noexcept
  *  Getters: Library Elements
  ****************************************************************************************/
 
-Symbol* ProjectLibrary::getSymbol(const Uuid& uuid) const noexcept
+QHash<Uuid, library::Symbol*> ProjectLibrary::getSymbols() const throw (Exception)
+{
+    return getElements<Symbol>(mSymbols, mUnloadedSymbols);
+}
+
+QHash<Uuid, library::SpiceModel*> ProjectLibrary::getSpiceModels() const throw (Exception)
+{
+    return getElements<SpiceModel>(mSpiceModels, mUnloadedSpiceModels);
+}
+
+QHash<Uuid, library::Package*> ProjectLibrary::getPackages() const throw (Exception)
+{
+    return getElements<Package>(mPackages, mUnloadedPackages);
+}
+
+QHash<Uuid, library::Component*> ProjectLibrary::getComponents() const throw (Exception)
+{
+    return getElements<Component>(mComponents, mUnloadedComponents);
+}
+
+QHash<Uuid, library::Device*> ProjectLibrary::getDevices() const throw (Exception)
+{
+    return getElements<Device>(mDevices, mUnloadedDevices);
+}
+
+Symbol* ProjectLibrary::getSymbol(const Uuid& uuid) const throw (Exception)
 {
-    return mSymbols.value(uuid, 0);
+    return getElement<Symbol>(uuid, mSymbols, mUnloadedSymbols);
 }
 
-SpiceModel* ProjectLibrary::getSpiceModel(const Uuid& uuid) const noexcept
+SpiceModel* ProjectLibrary::getSpiceModel(const Uuid& uuid) const throw (Exception)
 {
-    return mSpiceModels.value(uuid, 0);
+    return getElement<SpiceModel>(uuid, mSpiceModels, mUnloadedSpiceModels);
 }
 
-Package* ProjectLibrary::getPackage(const Uuid& uuid) const noexcept
+Package* ProjectLibrary::getPackage(const Uuid& uuid) const throw (Exception)
 {
-    return mPackages.value(uuid, 0);
+    return getElement<Package>(uuid, mPackages, mUnloadedPackages);
 }
 
-Component* ProjectLibrary::getComponent(const Uuid& uuid) const noexcept
+Component* ProjectLibrary::getComponent(const Uuid& uuid) const throw (Exception)
 {
-    return mComponents.value(uuid, 0);
+    return getElement<Component>(uuid, mComponents, mUnloadedComponents);
 }
 
-Device* ProjectLibrary::getDevice(const Uuid& uuid) const noexcept
+Device* ProjectLibrary::getDevice(const Uuid& uuid) const throw (Exception)
 {
-    return mDevices.value(uuid, 0);
+    return getElement<Device>(uuid, mDevices, mUnloadedDevices);
 }
 
 /*****************************************************************************************
  *  Getters: Special Queries
  ****************************************************************************************/
 
-QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(const Uuid& compUuid) const noexcept
+QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(const Uuid& compUuid) const throw (Exception)
 {
     QHash<Uuid, library::Device*> list;
-    foreach (library::Device* device, mDevices)
+    foreach (library::Device* device, getDevices()) // can throw
     {
         if (device->getComponentUuid() == compUuid)
             list.insert(device->getUuid(), device);
@@ -151,51 +196,61 @@ QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(const Uuid&
 
 void ProjectLibrary::addSymbol(library::Symbol& s) throw (Exception)
 {
-    addElement<Symbol>(s, mSymbols, mAddedSymbols, mRemovedSymbols);
+    QMutexLocker locker(&mMutex);
+    addElement<Symbol>(s, mSymbols, mUnloadedSymbols, mAddedSymbols, mRemovedSymbols);
 }
 
 void ProjectLibrary::addSpiceModel(library::SpiceModel& m) throw (Exception)
 {
-    addElement<SpiceModel>(m, mSpiceModels, mAddedSpiceModels, mRemovedSpiceModels);
+    QMutexLocker locker(&mMutex);
+    addElement<SpiceModel>(m, mSpiceModels, mUnloadedSpiceModels, mAddedSpiceModels, mRemovedSpiceModels);
 }
 
 void ProjectLibrary::addPackage(library::Package& p) throw (Exception)
 {
-    addElement<Package>(p, mPackages, mAddedPackages, mRemovedPackages);
+    QMutexLocker locker(&mMutex);
+    addElement<Package>(p, mPackages, mUnloadedPackages, mAddedPackages, mRemovedPackages);
 }
 
 void ProjectLibrary::addComponent(library::Component& c) throw (Exception)
 {
-    addElement<Component>(c, mComponents, mAddedComponents, mRemovedComponents);
+    QMutexLocker locker(&mMutex);
+    addElement<Component>(c, mComponents, mUnloadedComponents, mAddedComponents, mRemovedComponents);
 }
 
 void ProjectLibrary::addDevice(library::Device& d) throw (Exception)
 {
-    addElement<Device>(d, mDevices, mAddedDevices, mRemovedDevices);
+    QMutexLocker locker(&mMutex);
+    addElement<Device>(d, mDevices, mUnloadedDevices, mAddedDevices, mRemovedDevices);
 }
 
 void ProjectLibrary::removeSymbol(library::Symbol& s) throw (Exception)
 {
+    QMutexLocker locker(&mMutex);
     removeElement<Symbol>(s, mSymbols, mAddedSymbols, mRemovedSymbols);
 }
 
 void ProjectLibrary::removeSpiceModel(library::SpiceModel& m) throw (Exception)
 {
+    QMutexLocker locker(&mMutex);
     removeElement<SpiceModel>(m, mSpiceModels, mAddedSpiceModels, mRemovedSpiceModels);
 }
 
 void ProjectLibrary::removePackage(library::Package& p) throw (Exception)
 {
+    QMutexLocker locker(&mMutex);
     removeElement<Package>(p, mPackages, mAddedPackages, mRemovedPackages);
 }
 
 void ProjectLibrary::removeComponent(library::Component& c) throw (Exception)
 {
+    QMutexLocker locker(&mMutex);
     removeElement<Component>(c, mComponents, mAddedComponents, mRemovedComponents);
 }
 
 void ProjectLibrary::removeDevice(library::Device& d) throw (Exception)
 {
+    QMutexLocker locker(&mMutex);
     removeElement<Device>(d, mDevices, mAddedDevices, mRemovedDevices);
 }
 
@@ -204,11 +259,18 @@ void ProjectLibrary::removeDevice(library::Device& d) throw (Exception)
  *  General Methods
  ****************************************************************************************/
 
+void ProjectLibrary::startPrefetch() noexcept
+{
+    if (mPrefetchFuture.isRunning()) return;
+    mPrefetchFuture = QtConcurrent::run(this, &ProjectLibrary::prefetch);
+}
+
 bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
 {
+    QMutexLocker locker(&mMutex);
     bool success = true;
 
-    // Save all elements
+    // Save all elements (not yet loaded elements are already at the right place)
     if (!saveElements<Symbol>(toOriginal, errors, mLibraryPath.getPathTo("sym"), mSymbols, mAddedSymbols, mRemovedSymbols))
         success = false;
     if (!saveElements<SpiceModel>(toOriginal, errors, mLibraryPath.getPathTo("spcmdl"), mSpiceModels, mAddedSpiceModels, mRemovedSpiceModels))
@@ -227,9 +289,25 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
  *  Private Methods
  ****************************************************************************************/
 
-template <typename ElementType>
-void ProjectLibrary::loadElements(const FilePath& directory, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList) throw (Exception)
+void ProjectLibrary::prefetch() noexcept
+{
+    try
+    {
+        if (!mPrefetchAborted.load()) loadElements<Symbol>    (mSymbols,     mUnloadedSymbols);
+        if (!mPrefetchAborted.load()) loadElements<SpiceModel>(mSpiceModels, mUnloadedSpiceModels);
+        if (!mPrefetchAborted.load()) loadElements<Package>   (mPackages,    mUnloadedPackages);
+        if (!mPrefetchAborted.load()) loadElements<Component> (mComponents,  mUnloadedComponents);
+        if (!mPrefetchAborted.load()) loadElements<Device>    (mDevices,     mUnloadedDevices);
+    }
+    catch (const Exception& e)
+    {
+        // not critical, the element will be loaded (and the error reported) on demand
+        qWarning() << "Failed to prefetch the project library:" << e.getDebugMsg();
+    }
+}
+
+void ProjectLibrary::indexElements(const FilePath& directory, const QString& type,
+                                   QHash<Uuid, FilePath>& unloadedElements) throw (Exception)
 {
     QDir dir(directory.toStr());
 
@@ -247,29 +325,144 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
             continue;
         }
 
-        // load the library element --> an exception will be thrown on error
-        ElementType* element = new ElementType(subdirPath, false);
-
-        if (elementList.contains(element->getUuid()))
+        // the directory name is the UUID of the element (checked in adoptElement())
+        Uuid uuid(subdirPath.getBasename());
+        if (uuid.isNull())
+        {
+            qWarning() << "Found an invalid directory in the library:" << subdirPath.toNative();
+            continue;
+        }
+        if (unloadedElements.contains(uuid))
         {
-            throw RuntimeError(__FILE__, __LINE__, element->getUuid().toStr(),
+            throw RuntimeError(__FILE__, __LINE__, uuid.toStr(),
                 QString(tr("There are multiple library elements with the same "
-                "UUID in the directory \"%1\"")).arg(subdirPath.toNative()));
+                "UUID in the directory \"%1\"")).arg(directory.toNative()));
         }
 
-        elementList.insert(element->getUuid(), element);
+        unloadedElements.insert(uuid, subdirPath);
+    }
+
+    qDebug() << "successfully indexed" << unloadedElements.count() << qPrintable(type);
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::getElement(const Uuid& uuid, QHash<Uuid, ElementType*>& elementList,
+                                        QHash<Uuid, FilePath>& unloadedElements) const throw (Exception)
+{
+    QMutexLocker locker(&mMutex);
+    if (ElementType* element = elementList.value(uuid, nullptr)) return element;
+    if (!unloadedElements.contains(uuid)) return nullptr;
+    LoadedElement loaded{unloadedElements.value(uuid), thread(), nullptr, {}};
+
+    // parse the element without holding the lock, other threads may load other elements
+    locker.unlock();
+    loaded = loadElement<ElementType>(loaded);
+    locker.relock();
+    auto sg = scopeGuard([&](){delete loaded.element;});
+    return adoptElement<ElementType>(loaded, elementList, unloadedElements); // can throw
+}
+
+template <typename ElementType>
+QHash<Uuid, ElementType*> ProjectLibrary::getElements(QHash<Uuid, ElementType*>& elementList,
+                                                      QHash<Uuid, FilePath>& unloadedElements) const throw (Exception)
+{
+    loadElements<ElementType>(elementList, unloadedElements); // can throw
+    QMutexLocker locker(&mMutex);
+    return elementList; // a copy, the list may be modified by other threads afterwards
+}
+
+template <typename ElementType>
+void ProjectLibrary::loadElements(QHash<Uuid, ElementType*>& elementList,
+                                  QHash<Uuid, FilePath>& unloadedElements) const throw (Exception)
+{
+    QList<LoadedElement> elementsToLoad;
+    {
+        QMutexLocker locker(&mMutex);
+        foreach (const FilePath& directory, unloadedElements)
+            elementsToLoad.append(LoadedElement{directory, thread(), nullptr, {}});
+    }
+    if (elementsToLoad.isEmpty()) return;
+
+    // load all library elements in parallel...
+    QList<LoadedElement> loadedElements = QtConcurrent::blockingMapped<QList<LoadedElement>>(
+        elementsToLoad, &ProjectLibrary::loadElement<ElementType>);
+    auto sg = scopeGuard([&](){
+        foreach (const LoadedElement& loaded, loadedElements) delete loaded.element;
+    });
+
+    // ...and add them to the element list (the first error is thrown after adding all
+    // successfully loaded elements)
+    QMutexLocker locker(&mMutex);
+    QSharedPointer<Exception> error;
+    for (int i = 0; i < loadedElements.count(); ++i)
+    {
+        try
+        {
+            adoptElement<ElementType>(loadedElements[i], elementList, unloadedElements);
+        }
+        catch (const Exception& e)
+        {
+            if (!error) error.reset(e.clone());
+        }
+    }
+    if (error) error->raise();
+}
+
+template <typename ElementType>
+ProjectLibrary::LoadedElement ProjectLibrary::loadElement(const LoadedElement& input) noexcept
+{
+    LoadedElement result(input);
+    try
+    {
+        // load the library element --> an exception will be thrown on error
+        QScopedPointer<ElementType> element(new ElementType(input.directory, false));
+        element->moveToThread(input.thread); // must be done from the current thread
+        result.element = element.take();
+    }
+    catch (const Exception& e)
+    {
+        result.error.reset(e.clone());
+    }
+    return result;
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::adoptElement(LoadedElement& loaded,
+                                          QHash<Uuid, ElementType*>& elementList,
+                                          QHash<Uuid, FilePath>& unloadedElements) const throw (Exception)
+{
+    // the caller must hold mMutex
+    Uuid uuid(loaded.directory.getBasename()); // the key of the directory, see indexElements()
+    if (unloadedElements.value(uuid) != loaded.directory) {
+        // already loaded by another thread (then "loaded" will be deleted) or removed
+        // from the library in the meantime
+        return elementList.value(uuid, nullptr);
+    }
+
+    // the directory is loaded only once, even if loading it fails (otherwise it would be
+    // parsed again and again by every call to loadElements())
+    unloadedElements.remove(uuid);
+    if (loaded.error) loaded.error->raise(); // an error occurred while loading
+    ElementType* element = static_cast<ElementType*>(loaded.element);
+    if (element->getUuid() != uuid) {
+        throw RuntimeError(__FILE__, __LINE__, element->getUuid().toStr(),
+            QString(tr("The UUID of the library element \"%1\" does not match its "
+            "directory name.")).arg(loaded.directory.toNative()));
     }
 
-    qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
+    elementList.insert(uuid, element);
+    loaded.element = nullptr; // the ownership is now transferred to the element list
+    return element;
 }
 
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList,
+                                const QHash<Uuid, FilePath>& unloadedElements,
                                 QList<ElementType*>& addedElementsList,
                                 QList<ElementType*>& removedElementsList) throw (Exception)
 {
-    if (elementList.contains(element.getUuid())) {
+    if (elementList.contains(element.getUuid()) || unloadedElements.contains(element.getUuid())) {
         throw LogicError(__FILE__, __LINE__, QString(), QString(tr(
             "There is already an element with the same UUID in the project's library: %1"))
             .arg(element.getUuid().toStr()));
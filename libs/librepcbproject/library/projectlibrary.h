@@ -34,6 +34,7 @@
 namespace librepcb {
 
 namespace library {
+class LibraryBaseElement;
 class Symbol;
 class SpiceModel;
 class Package;
@@ -52,6 +53,10 @@ class Project;
 /**
  * @brief The ProjectLibrary class
  *
+ * In lazy mode, only the UUID to directory index of all library elements is built in the
+ * constructor. The elements are then parsed on demand (thread-safe) by the first call to
+ * #getSymbol(), #getPackage() and so on, or in advance by #startPrefetch().
+ *
  * @todo Adding and removing elements is very provisional. It does not really work
  *       together with the automatic backup/restore feature of projects.
  */
@@ -62,23 +67,29 @@ class ProjectLibrary final : public QObject
     public:
 
         // Constructors / Destructor
-        explicit ProjectLibrary(Project& project, bool restore, bool readOnly) throw (Exception);
+        explicit ProjectLibrary(Project& project, bool restore, bool readOnly,
+                                bool lazy = false) throw (Exception);
         ~ProjectLibrary() noexcept;
 
         // Getters: Library Elements
-        const QHash<Uuid, library::Symbol*>&     getSymbols()        const noexcept {return mSymbols;}
-        const QHash<Uuid, library::SpiceModel*>& getSpiceModels()    const noexcept {return mSpiceModels;}
-        const QHash<Uuid, library::Package*>&    getPackages()       const noexcept {return mPackages;}
-        const QHash<Uuid, library::Component*>&  getComponents()     const noexcept {return mComponents;}
-        const QHash<Uuid, library::Device*>&     getDevices()        const noexcept {return mDevices;}
-        library::Symbol*      getSymbol(     const Uuid& uuid) const noexcept;
-        library::SpiceModel*  getSpiceModel( const Uuid& uuid) const noexcept;
-        library::Package*     getPackage(    const Uuid& uuid) const noexcept;
-        library::Component*   getComponent(  const Uuid& uuid) const noexcept;
-        library::Device*      getDevice(     const Uuid& uuid) const noexcept;
+        //
+        // The element lists are returned as copies because they may be modified by
+        // other threads (prefetching) at any time. In lazy mode, these methods load the
+        // requested elements first and throw an exception if an element could not be
+        // loaded. The single element getters return nullptr if there is no such element.
+        QHash<Uuid, library::Symbol*>     getSymbols()     const throw (Exception);
+        QHash<Uuid, library::SpiceModel*> getSpiceModels() const throw (Exception);
+        QHash<Uuid, library::Package*>    getPackages()    const throw (Exception);
+        QHash<Uuid, library::Component*>  getComponents()  const throw (Exception);
+        QHash<Uuid, library::Device*>     getDevices()     const throw (Exception);
+        library::Symbol*      getSymbol(     const Uuid& uuid) const throw (Exception);
+        library::SpiceModel*  getSpiceModel( const Uuid& uuid) const throw (Exception);
+        library::Package*     getPackage(    const Uuid& uuid) const throw (Exception);
+        library::Component*   getComponent(  const Uuid& uuid) const throw (Exception);
+        library::Device*      getDevice(     const Uuid& uuid) const throw (Exception);
 
         // Getters: Special Queries
-        QHash<Uuid, library::Device*> getDevicesOfComponent(const Uuid& compUuid) const noexcept;
+        QHash<Uuid, library::Device*> getDevicesOfComponent(const Uuid& compUuid) const throw (Exception);
 
 
         // Add/Remove Methods
@@ -95,6 +106,15 @@ class ProjectLibrary final : public QObject
 
 
         // General Methods
+
+        /**
+         * @brief Load all not yet loaded library elements in a background thread
+         *
+         * This is only useful in lazy mode, elements which are requested in the meantime
+         * are still loaded on demand by the calling thread.
+         */
+        void startPrefetch() noexcept;
+
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
 
@@ -105,13 +125,41 @@ class ProjectLibrary final : public QObject
         ProjectLibrary(const ProjectLibrary& other);
         ProjectLibrary& operator=(const ProjectLibrary& rhs);
 
+        // Private Types
+
+        /**
+         * @brief A library element which is loaded by #loadElement() in a worker thread
+         */
+        struct LoadedElement {
+            FilePath directory;
+            QThread* thread;                        ///< the thread to move the element to
+            library::LibraryBaseElement* element;   ///< nullptr on error (owned by the receiver)
+            QSharedPointer<Exception> error;        ///< nullptr on success
+        };
+
         // Private Methods
+        void prefetch() noexcept;
+        void indexElements(const FilePath& directory, const QString& type,
+                           QHash<Uuid, FilePath>& unloadedElements) throw (Exception);
         template <typename ElementType>
-        void loadElements(const FilePath& directory, const QString& type,
-                          QHash<Uuid, ElementType*>& elementList) throw (Exception);
+        ElementType* getElement(const Uuid& uuid, QHash<Uuid, ElementType*>& elementList,
+                                QHash<Uuid, FilePath>& unloadedElements) const throw (Exception);
+        template <typename ElementType>
+        QHash<Uuid, ElementType*> getElements(QHash<Uuid, ElementType*>& elementList,
+                                              QHash<Uuid, FilePath>& unloadedElements) const throw (Exception);
+        template <typename ElementType>
+        void loadElements(QHash<Uuid, ElementType*>& elementList,
+                          QHash<Uuid, FilePath>& unloadedElements) const throw (Exception);
+        template <typename ElementType>
+        static LoadedElement loadElement(const LoadedElement& input) noexcept;
+        template <typename ElementType>
+        ElementType* adoptElement(LoadedElement& loaded,
+                                  QHash<Uuid, ElementType*>& elementList,
+                                  QHash<Uuid, FilePath>& unloadedElements) const throw (Exception);
         template <typename ElementType>
         void addElement(ElementType& element,
                         QHash<Uuid, ElementType*>& elementList,
+                        const QHash<Uuid, FilePath>& unloadedElements,
                         QList<ElementType*>& addedElementsList,
                         QList<ElementType*>& removedElementsList) throw (Exception);
         template <typename ElementType>
@@ -131,13 +179,23 @@ class ProjectLibrary final : public QObject
         // General
         Project& mProject; ///< a reference to the Project object (from the ctor)
         FilePath mLibraryPath; ///< the "library" directory of the project
-
-        // The Library Elements
-        QHash<Uuid, library::Symbol*> mSymbols;
-        QHash<Uuid, library::SpiceModel*> mSpiceModels;
-        QHash<Uuid, library::Package*> mPackages;
-        QHash<Uuid, library::Component*> mComponents;
-        QHash<Uuid, library::Device*> mDevices;
+        mutable QMutex mMutex; ///< protects the element lists against concurrent loading
+        QFuture<void> mPrefetchFuture; ///< the background job started by #startPrefetch()
+        QAtomicInt mPrefetchAborted; ///< set to 1 to stop the prefetching
+
+        // The Library Elements (mutable because they get filled on demand in lazy mode)
+        mutable QHash<Uuid, library::Symbol*> mSymbols;
+        mutable QHash<Uuid, library::SpiceModel*> mSpiceModels;
+        mutable QHash<Uuid, library::Package*> mPackages;
+        mutable QHash<Uuid, library::Component*> mComponents;
+        mutable QHash<Uuid, library::Device*> mDevices;
+
+        // Not yet Loaded Library Elements (UUID --> element directory)
+        mutable QHash<Uuid, FilePath> mUnloadedSymbols;
+        mutable QHash<Uuid, FilePath> mUnloadedSpiceModels;
+        mutable QHash<Uuid, FilePath> mUnloadedPackages;
+        mutable QHash<Uuid, FilePath> mUnloadedComponents;
+        mutable QHash<Uuid, FilePath> mUnloadedDevices;
 
         // Added Library Elements
         QList<library::Symbol*> mAddedSymbols;
@@ -13,7 +13,7 @@ GENERATED_DIR = ../../generated
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -68,6 +68,7 @@ SOURCES += \
     library/projectlibrary.cpp \
     erc/ercmsg.cpp \
     erc/ercmsglist.cpp \
+    erc/if_ercmsgprovider.cpp \
     cmd/cmdprojectsetmetadata.cpp \
     settings/projectsettings.cpp \
     settings/cmd/cmdprojectsettingschange.cpp \
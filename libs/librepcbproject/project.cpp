@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent>
 #include <QPrinter>
 #include <librepcbcommon/exceptions.h>
 #include <librepcbcommon/fileio/filelock.h>
@@ -29,6 +30,7 @@
 #include <librepcbcommon/fileio/xmldomdocument.h>
 #include <librepcbcommon/fileio/xmldomelement.h>
 #include <librepcbcommon/systeminfo.h>
+#include <librepcbcommon/scopeguard.h>
 #include <librepcbcommon/schematiclayer.h>
 #include "project.h"
 #include "library/projectlibrary.h"
@@ -190,6 +192,37 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Ex
             mLastModified = root->getFirstChild("meta/last_modified", true, true)->getText<QDateTime>(true);
         }
 
+        // Start opening and parsing all schematic and board files in worker threads (parse
+        // phase). The schematics and boards are then created in the main thread after the
+        // library and the circuit are loaded (link phase), see below.
+        QList<ParsedXmlFile> xmlFilesToParse;
+        int schematicFilesCount = 0;
+        if (!create)
+        {
+            for (XmlDomElement* node = root->getFirstChild("schematics/schematic", true, false);
+                 node; node = node->getNextSibling("schematic"))
+            {
+                FilePath fp = FilePath::fromRelative(mPath.getPathTo("schematics"), node->getText<QString>(true));
+                xmlFilesToParse.append(ParsedXmlFile{fp, mIsRestored, mIsReadOnly, nullptr, {}, {}});
+            }
+            schematicFilesCount = xmlFilesToParse.count();
+            for (XmlDomElement* node = root->getFirstChild("boards/board", true, false);
+                 node; node = node->getNextSibling("board"))
+            {
+                FilePath fp = FilePath::fromRelative(mPath.getPathTo("boards"), node->getText<QString>(true));
+                xmlFilesToParse.append(ParsedXmlFile{fp, mIsRestored, mIsReadOnly, nullptr, {}, {}});
+            }
+        }
+        QFuture<ParsedXmlFile> parseFuture = QtConcurrent::mapped(xmlFilesToParse, &Project::parseXmlFile);
+        QList<ParsedXmlFile> parsedXmlFiles;
+        bool parseFinished = false;
+        auto parseSg = scopeGuard([&](){
+            // never leave the constructor while the worker threads are still running, and
+            // free all opened files which were not taken over by a schematic or board
+            if (!parseFinished) parsedXmlFiles = parseFuture.results(); // blocks
+            foreach (const ParsedXmlFile& file, parsedXmlFiles) delete file.xmlFile;
+        });
+
         // Load description HTML file
         if (create)
             mDescriptionHtmlFile = SmartTextFile::create(mPath.getPathTo("description/index.html"));
@@ -199,13 +232,18 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Ex
 
         // Create all needed objects
         mProjectSettings = new ProjectSettings(*this, mIsRestored, mIsReadOnly, create);
-        mProjectLibrary = new ProjectLibrary(*this, mIsRestored, mIsReadOnly);
+        mProjectLibrary = new ProjectLibrary(*this, mIsRestored, mIsReadOnly, true); // lazy
+        mProjectLibrary->startPrefetch(); // load the remaining elements in the background
         mErcMsgList = new ErcMsgList(*this, mIsRestored, mIsReadOnly, create);
         mCircuit = new Circuit(*this, mIsRestored, mIsReadOnly, create);
 
         // Load all schematic layers
         mSchematicLayerProvider = new SchematicLayerProvider(*this);
 
+        // wait until all schematic and board files are parsed
+        parsedXmlFiles = parseFuture.results(); // blocks
+        parseFinished = true;
+
         // Load all schematics
         if (create)
         {
@@ -215,11 +253,14 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Ex
         }
         else
         {
-            for (XmlDomElement* node = root->getFirstChild("schematics/schematic", true, false);
-                 node; node = node->getNextSibling("schematic"))
+            for (int i = 0; i < schematicFilesCount; ++i)
             {
-                FilePath fp = FilePath::fromRelative(mPath.getPathTo("schematics"), node->getText<QString>(true));
-                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
+                ParsedXmlFile& file = parsedXmlFiles[i];
+                if (file.error) file.error->raise();
+                SmartXmlFile* xmlFile = file.xmlFile;
+                file.xmlFile = nullptr; // the schematic takes the ownership
+                Schematic* schematic = new Schematic(*this, xmlFile, *file.doc);
+                file.doc.reset(); // free the DOM tree as early as possible
                 addSchematic(*schematic);
             }
             qDebug() << mSchematics.count() << "schematics successfully loaded!";
@@ -234,11 +275,14 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Ex
         }
         else
         {
-            for (XmlDomElement* node = root->getFirstChild("boards/board", true, false);
-                 node; node = node->getNextSibling("board"))
+            for (int i = schematicFilesCount; i < parsedXmlFiles.count(); ++i)
             {
-                FilePath fp = FilePath::fromRelative(mPath.getPathTo("boards"), node->getText<QString>(true));
-                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
+                ParsedXmlFile& file = parsedXmlFiles[i];
+                if (file.error) file.error->raise();
+                SmartXmlFile* xmlFile = file.xmlFile;
+                file.xmlFile = nullptr; // the board takes the ownership
+                Board* board = new Board(*this, xmlFile, *file.doc);
+                file.doc.reset(); // free the DOM tree as early as possible
                 addBoard(*board);
             }
             qDebug() << mBoards.count() << "boards successfully loaded!";
@@ -314,7 +358,7 @@ void Project::setName(const QString& newName) noexcept
 {
     if (newName != mName) {
         mName = newName;
-        emit attributesChanged();
+        emit attributesChanged("NAME");
     }
 }
 
@@ -330,7 +374,7 @@ void Project::setAuthor(const QString& newAuthor) noexcept
 {
     if (newAuthor != mAuthor) {
         mAuthor = newAuthor;
-        emit attributesChanged();
+        emit attributesChanged("AUTHOR");
     }
 }
 
@@ -338,7 +382,7 @@ void Project::setCreated(const QDateTime& newCreated) noexcept
 {
     if (newCreated != mCreated) {
         mCreated = newCreated;
-        emit attributesChanged();
+        emit attributesChanged("CREATED");
     }
 }
 
@@ -346,7 +390,7 @@ void Project::setLastModified(const QDateTime& newLastModified) noexcept
 {
     if (newLastModified != mLastModified) {
         mLastModified = newLastModified;
-        emit attributesChanged();
+        emit attributesChanged("LAST_MODIFIED");
     }
 }
 
@@ -563,11 +607,11 @@ void Project::removeBoard(Board& board, bool deleteBoard) throw (Exception)
  *  General Methods
  ****************************************************************************************/
 
-void Project::save(bool toOriginal) throw (Exception)
+void Project::save(bool toOriginal, SmartXmlFileWriter* writer) throw (Exception)
 {
     QStringList errors;
 
-    if (!save(toOriginal, errors))
+    if (!save(toOriginal, errors, writer))
     {
         QString msg = QString(tr("The project could not be saved!\n\nError Message:\n%1",
             "variable count of error messages", errors.count())).arg(errors.join("\n"));
@@ -638,7 +682,7 @@ XmlDomElement* Project::serializeToXmlDomElement() const throw (Exception)
     return root.take();
 }
 
-bool Project::save(bool toOriginal, QStringList& errors) noexcept
+bool Project::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
@@ -652,9 +696,9 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     try
     {
         setLastModified(QDateTime::currentDateTime());
-        XmlDomDocument doc(*serializeToXmlDomElement());
-        doc.setFileVersion(APP_VERSION_MAJOR);
-        mXmlFile->save(doc, toOriginal);
+        QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+        doc->setFileVersion(APP_VERSION_MAJOR);
+        mXmlFile->save(doc, toOriginal, 0, writer);
     }
     catch (Exception& e)
     {
@@ -674,7 +718,7 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     }
 
     // Save circuit
-    if (!mCircuit->save(toOriginal, errors))
+    if (!mCircuit->save(toOriginal, errors, writer))
         success = false;
 
     // Save all removed schematics (*.xml files)
@@ -686,7 +730,7 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     // Save all added schematics (*.xml files)
     foreach (Schematic* schematic, mSchematics)
     {
-        if (!schematic->save(toOriginal, errors))
+        if (!schematic->save(toOriginal, errors, writer))
             success = false;
     }
 
@@ -699,7 +743,7 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     // Save all added boards (*.xml files)
     foreach (Board* board, mBoards)
     {
-        if (!board->save(toOriginal, errors))
+        if (!board->save(toOriginal, errors, writer))
             success = false;
     }
 
@@ -708,11 +752,11 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
         success = false;
 
     // Save settings
-    if (!mProjectSettings->save(toOriginal, errors))
+    if (!mProjectSettings->save(toOriginal, errors, writer))
         success = false;
 
     // Save ERC messages list
-    if (!mErcMsgList->save(toOriginal, errors))
+    if (!mErcMsgList->save(toOriginal, errors, writer))
         success = false;
 
     // if the project was restored from a backup, reset the mIsRestored flag as the current
@@ -752,6 +796,23 @@ void Project::printSchematicPages(QPrinter& printer, QList<int>& pages) throw (E
     }
 }
 
+Project::ParsedXmlFile Project::parseXmlFile(const ParsedXmlFile& file) noexcept
+{
+    ParsedXmlFile result(file);
+    try
+    {
+        QScopedPointer<SmartXmlFile> xmlFile(new SmartXmlFile(file.filepath, file.restore,
+                                                              file.readOnly));
+        result.doc = xmlFile->parseFileAndBuildDomTree(true);
+        result.xmlFile = xmlFile.take();
+    }
+    catch (const Exception& e)
+    {
+        result.error.reset(e.clone());
+    }
+    return result;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
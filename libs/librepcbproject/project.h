@@ -41,6 +41,8 @@ namespace librepcb {
 
 class SmartTextFile;
 class SmartXmlFile;
+class SmartXmlFileWriter;
+class XmlDomDocument;
 
 namespace project {
 
@@ -442,12 +444,15 @@ class Project final : public QObject, public IF_AttributeProvider,
          * @brief Save the whole project to the harddisc
          *
          * @param toOriginal    If false, the project is saved only to temporary files
+         * @param writer        If not nullptr, the XML files are only serialized and
+         *                      queued to this writer (which then has to be started)
+         *                      instead of writing them immediately
          *
          * @note The whole save procedere is described in @ref doc_project_save.
          *
          * @throw Exception on error
          */
-        void save(bool toOriginal) throw (Exception);
+        void save(bool toOriginal, SmartXmlFileWriter* writer = nullptr) throw (Exception);
 
 
         // Helper Methods
@@ -468,7 +473,7 @@ class Project final : public QObject, public IF_AttributeProvider,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
         /**
          * @brief This signal is emitted after a schematic was added to the project
@@ -507,6 +512,22 @@ class Project final : public QObject, public IF_AttributeProvider,
         Project& operator=(const Project& rhs);
 
 
+        // Private Types
+
+        /**
+         * @brief An XML file which is opened and parsed by #parseXmlFile() (in a worker
+         *        thread) before the corresponding object is created in the main thread
+         */
+        struct ParsedXmlFile {
+            FilePath filepath;
+            bool restore;
+            bool readOnly;
+            SmartXmlFile* xmlFile;                  ///< nullptr on error (owned by the receiver)
+            QSharedPointer<XmlDomDocument> doc;     ///< nullptr on error
+            QSharedPointer<Exception> error;        ///< nullptr on success
+        };
+
+
         // Private Methods
 
         /**
@@ -534,10 +555,11 @@ class Project final : public QObject, public IF_AttributeProvider,
          *
          * @param toOriginal    True: save to original files; False: save to temporary files
          * @param errors        All errors will be added to this string list (translated)
+         * @param writer        See #save(bool, SmartXmlFileWriter*)
          *
          * @return True on success (then the error list should be empty), false otherwise
          */
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept;
 
         /**
          * @brief Print some schematics to a QPrinter (printer or file)
@@ -549,6 +571,16 @@ class Project final : public QObject, public IF_AttributeProvider,
          */
         void printSchematicPages(QPrinter& printer, QList<int>& pages) throw (Exception);
 
+        /**
+         * @brief Open and parse an XML file (thread-safe, used for the parallel loading)
+         *
+         * @param file  The file to open (#ParsedXmlFile#filepath, #ParsedXmlFile#restore
+         *              and #ParsedXmlFile#readOnly must be set)
+         *
+         * @return A copy of the passed object with the parse result or the error filled in
+         */
+        static ParsedXmlFile parseXmlFile(const ParsedXmlFile& file) noexcept;
+
 
         // Project File (*.lpp)
         FilePath mPath; ///< the path to the project directory
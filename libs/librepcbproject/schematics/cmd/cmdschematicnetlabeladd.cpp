@@ -61,11 +61,13 @@ bool CmdSchematicNetLabelAdd::performExecute() throw (Exception)
 
 void CmdSchematicNetLabelAdd::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLabel(*mNetLabel); // can throw
 }
 
 void CmdSchematicNetLabelAdd::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLabel(*mNetLabel); // can throw
 }
 
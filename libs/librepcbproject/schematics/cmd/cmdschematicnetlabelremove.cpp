@@ -46,6 +46,20 @@ CmdSchematicNetLabelRemove::~CmdSchematicNetLabelRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetLabelRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        // the removed netlabel and its graphics item (with the cached text layout)
+        size += sizeof(SI_NetLabel) + 1024;
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -59,11 +73,13 @@ bool CmdSchematicNetLabelRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetLabelRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLabel(mNetLabel); // can throw
 }
 
 void CmdSchematicNetLabelRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLabel(mNetLabel); // can throw
 }
 
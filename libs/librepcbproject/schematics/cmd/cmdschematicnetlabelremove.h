@@ -50,6 +50,11 @@ class CmdSchematicNetLabelRemove final : public UndoCommand
         CmdSchematicNetLabelRemove(Schematic& schematic, SI_NetLabel& netlabel) noexcept;
         ~CmdSchematicNetLabelRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
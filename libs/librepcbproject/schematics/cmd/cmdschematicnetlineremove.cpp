@@ -45,6 +45,19 @@ CmdSchematicNetLineRemove::~CmdSchematicNetLineRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetLineRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        size += sizeof(SI_NetLine) + 512; // the removed netline and its graphics item
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +71,13 @@ bool CmdSchematicNetLineRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetLineRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLine(mNetLine); // can throw
 }
 
 void CmdSchematicNetLineRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLine(mNetLine); // can throw
 }
 
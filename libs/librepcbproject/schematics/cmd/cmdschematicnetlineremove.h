@@ -50,6 +50,11 @@ class CmdSchematicNetLineRemove final : public UndoCommand
         explicit CmdSchematicNetLineRemove(SI_NetLine& netline) noexcept;
         ~CmdSchematicNetLineRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
@@ -84,11 +84,13 @@ bool CmdSchematicNetPointAdd::performExecute() throw (Exception)
 
 void CmdSchematicNetPointAdd::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetPoint(*mNetPoint); // can throw
 }
 
 void CmdSchematicNetPointAdd::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetPoint(*mNetPoint); // can throw
 }
 
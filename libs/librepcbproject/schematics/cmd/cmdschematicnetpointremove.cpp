@@ -45,6 +45,19 @@ CmdSchematicNetPointRemove::~CmdSchematicNetPointRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetPointRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        size += sizeof(SI_NetPoint) + 512; // the removed netpoint and its graphics item
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +71,13 @@ bool CmdSchematicNetPointRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetPointRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetPoint(mNetPoint); // can throw
 }
 
 void CmdSchematicNetPointRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetPoint(mNetPoint); // can throw
 }
 
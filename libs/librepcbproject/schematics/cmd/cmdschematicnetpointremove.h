@@ -50,6 +50,11 @@ class CmdSchematicNetPointRemove final : public UndoCommand
         explicit CmdSchematicNetPointRemove(SI_NetPoint& netpoint) noexcept;
         ~CmdSchematicNetPointRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
@@ -76,11 +76,13 @@ bool CmdSymbolInstanceAdd::performExecute() throw (Exception)
 
 void CmdSymbolInstanceAdd::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeSymbol(*mSymbolInstance); // can throw
 }
 
 void CmdSymbolInstanceAdd::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addSymbol(*mSymbolInstance); // can throw
 }
 
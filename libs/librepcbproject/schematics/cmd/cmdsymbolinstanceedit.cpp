@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdsymbolinstanceedit.h"
 #include "../items/si_symbol.h"
+#include "../schematic.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -99,12 +100,14 @@ bool CmdSymbolInstanceEdit::performExecute() throw (Exception)
 
 void CmdSymbolInstanceEdit::performUndo() throw (Exception)
 {
+    mSymbol.getSchematic().setModified();
     mSymbol.setPosition(mOldPos);
     mSymbol.setRotation(mOldRotation);
 }
 
 void CmdSymbolInstanceEdit::performRedo() throw (Exception)
 {
+    mSymbol.getSchematic().setModified();
     mSymbol.setPosition(mNewPos);
     mSymbol.setRotation(mNewRotation);
 }
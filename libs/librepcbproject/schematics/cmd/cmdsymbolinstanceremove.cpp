@@ -24,6 +24,7 @@
 #include "cmdsymbolinstanceremove.h"
 #include "../schematic.h"
 #include "../items/si_symbol.h"
+#include "../items/si_symbolpin.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -45,6 +46,22 @@ CmdSymbolInstanceRemove::~CmdSymbolInstanceRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSymbolInstanceRemove::getEstimatedMemorySize() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemorySize();
+    if (isCurrentlyExecuted()) {
+        // the removed symbol with all its pins and graphics items (including the
+        // cached texts and shapes) is kept alive only by this command
+        qint64 pinCount = mSymbol.getPins().count();
+        size += sizeof(SI_Symbol) + 4096 + pinCount * (sizeof(SI_SymbolPin) + 1024);
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -58,11 +75,13 @@ bool CmdSymbolInstanceRemove::performExecute() throw (Exception)
 
 void CmdSymbolInstanceRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addSymbol(mSymbol); // can throw
 }
 
 void CmdSymbolInstanceRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeSymbol(mSymbol); // can throw
 }
 
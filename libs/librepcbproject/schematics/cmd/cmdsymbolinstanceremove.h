@@ -50,6 +50,11 @@ class CmdSymbolInstanceRemove final : public UndoCommand
         CmdSymbolInstanceRemove(Schematic& schematic, SI_Symbol& symbol) noexcept;
         ~CmdSymbolInstanceRemove() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
 
     private:
 
@@ -33,7 +33,8 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-SGI_Base::SGI_Base() noexcept
+SGI_Base::SGI_Base(SI_Base& schematicItem) noexcept :
+    mSchematicItem(schematicItem)
 {
 
 }
@@ -34,6 +34,8 @@
 namespace librepcb {
 namespace project {
 
+class SI_Base;
+
 /*****************************************************************************************
  *  Class SGI_Base
  ****************************************************************************************/
@@ -46,9 +48,12 @@ class SGI_Base : public GraphicsItem
     public:
 
         // Constructors / Destructor
-        explicit SGI_Base() noexcept;
+        explicit SGI_Base(SI_Base& schematicItem) noexcept;
         virtual ~SGI_Base() noexcept;
 
+        // Getters
+        SI_Base& getSchematicItem() const noexcept {return mSchematicItem;}
+
 
     private:
 
@@ -56,6 +61,10 @@ class SGI_Base : public GraphicsItem
         //SGI_Base() = delete;
         SGI_Base(const SGI_Base& other) = delete;
         SGI_Base& operator=(const SGI_Base& rhs) = delete;
+
+
+        // Attributes
+        SI_Base& mSchematicItem; ///< the schematic item this graphics item belongs to
 };
 
 /*****************************************************************************************
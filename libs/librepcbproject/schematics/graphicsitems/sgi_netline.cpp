@@ -42,7 +42,7 @@ namespace project {
  ****************************************************************************************/
 
 SGI_NetLine::SGI_NetLine(SI_NetLine& netline) noexcept :
-    SGI_Base(), mNetLine(netline), mLayer(nullptr)
+    SGI_Base(netline), mNetLine(netline), mLayer(nullptr)
 {
     setZValue(Schematic::ZValue_NetLines);
 
@@ -85,15 +85,18 @@ void SGI_NetLine::updateCacheAndRepaint() noexcept
 
 void SGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
     bool highlight = mNetLine.isSelected() || mNetLine.getNetSignal().isHighlighted();
 
-    // draw line
+    // draw line (as cosmetic hairline if it is too thin to see its width anyway)
     if (mLayer->isVisible())
     {
-        QPen pen(mLayer->getColor(highlight), mNetLine.getWidth().toPx(), Qt::SolidLine, Qt::RoundCap);
+        qreal width = mNetLine.getWidth().toPx();
+        if ((!deviceIsPrinter) && (lod * width < getLodThresholds().lineWidth)) width = 0;
+        QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
         painter->setPen(pen);
         painter->drawLine(mLineF);
     }
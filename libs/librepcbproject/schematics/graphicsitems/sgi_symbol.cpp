@@ -43,7 +43,8 @@ namespace project {
  ****************************************************************************************/
 
 SGI_Symbol::SGI_Symbol(SI_Symbol& symbol) noexcept :
-    SGI_Base(), mSymbol(symbol), mLibSymbol(symbol.getLibSymbol())
+    SGI_Base(symbol), mSymbol(symbol), mLibSymbol(symbol.getLibSymbol()),
+    mPrimitiveCache(PrimitivePathCache::getSharedCache(mLibSymbol))
 {
     setZValue(Schematic::ZValue_Symbols);
 
@@ -51,6 +52,13 @@ SGI_Symbol::SGI_Symbol(SI_Symbol& symbol) noexcept :
     mFont.setStyleHint(QFont::SansSerif);
     mFont.setFamily("Nimbus Sans L");
 
+    // parse all texts only once
+    for (int i = 0; i < mLibSymbol.getTextCount(); i++) {
+        const Text* text = mLibSymbol.getText(i);
+        Q_ASSERT(text); if (!text) continue;
+        mTextTemplates.insert(text, AttributeTextTemplate(text->getText()));
+    }
+
     updateCacheAndRepaint();
 }
 
@@ -97,9 +105,10 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
         // create static text properties
         CachedTextProperties_t props;
 
-        // get the text to display
-        props.text = text->getText();
-        mSymbol.replaceVariablesWithAttributes(props.text, true);
+        // get the text to display (only rebuilt if a referenced attribute has changed)
+        AttributeTextTemplate& textTemplate = mTextTemplates[text];
+        textTemplate.update(mSymbol, true);
+        props.text = textTemplate.getText();
 
         // calculate font metrics
         props.fontPixelSize = qCeil(text->getHeight().toPx());
@@ -142,6 +151,19 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     update();
 }
 
+void SGI_Symbol::updateAttributeTexts(const QString& key) noexcept
+{
+    bool modified = false;
+    for (auto it = mTextTemplates.begin(); it != mTextTemplates.end(); ++it) {
+        if (it.value().dependsOnAttribute(key) && it.value().update(mSymbol, true)) {
+            modified = true;
+        }
+    }
+    if (modified) {
+        updateCacheAndRepaint(); // relayout the texts (the templates are up to date)
+    }
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
@@ -154,59 +176,46 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
     const bool selected = mSymbol.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const LodThresholds_t& lodThresholds = getLodThresholds();
 
-    // draw all polygons
-    for (int i = 0; i < mLibSymbol.getPolygonCount(); i++)
+    // draw only the bounding rect if the symbol is too small to see any details
+    if ((!deviceIsPrinter) && (lod * qMax(mBoundingRect.width(), mBoundingRect.height())
+                               < lodThresholds.itemSize))
     {
-        const Polygon* polygon = mLibSymbol.getPolygon(i);
-        Q_ASSERT(polygon); if (!polygon) continue;
-
-        // set colors
-        layer = getSchematicLayer(polygon->getLayerId());
-        if (layer) {if (!layer->isVisible()) layer = nullptr;}
-        if (layer)
-            painter->setPen(QPen(layer->getColor(selected), polygon->getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-        else
-            painter->setPen(Qt::NoPen);
-        if (polygon->isFilled())
-            layer = getSchematicLayer(polygon->getLayerId());
-        else if (polygon->isGrabArea())
-            layer = getSchematicLayer(SchematicLayer::LayerID::SymbolGrabAreas);
-        else
-            layer = nullptr;
-        if (layer) {if (!layer->isVisible()) layer = nullptr;}
-        painter->setBrush(layer ? QBrush(layer->getColor(selected), Qt::SolidPattern) : Qt::NoBrush);
-
-        // draw polygon
-        painter->drawPath(polygon->toQPainterPathPx());
+        foreach (const PrimitivePathCache::Group_t& group, mPrimitiveCache->getGroups())
+        {
+            layer = getSchematicLayer(group.layerId);
+            if (!layer) continue;
+            if (!layer->isVisible()) continue;
+            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawRect(mBoundingRect);
+            break;
+        }
+        return;
     }
 
-    // draw all ellipses
-    for (int i = 0; i < mLibSymbol.getEllipseCount(); i++)
+    // draw all polygons and ellipses
+    foreach (const PrimitivePathCache::Group_t& group, mPrimitiveCache->getGroups())
     {
-        const Ellipse* ellipse = mLibSymbol.getEllipse(i);
-        Q_ASSERT(ellipse); if (!ellipse) continue;
-
         // set colors
-        layer = getSchematicLayer(ellipse->getLayerId());
+        layer = getSchematicLayer(group.layerId);
         if (layer) {if (!layer->isVisible()) layer = nullptr;}
         if (layer)
-            painter->setPen(QPen(layer->getColor(selected), ellipse->getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+            painter->setPen(QPen(layer->getColor(selected), group.lineWidth.toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
         else
             painter->setPen(Qt::NoPen);
-        if (ellipse->isFilled())
-            layer = getSchematicLayer(ellipse->getLayerId());
-        else if (ellipse->isGrabArea())
+        if (group.isFilled)
+            layer = getSchematicLayer(group.layerId);
+        else if (group.isGrabArea)
             layer = getSchematicLayer(SchematicLayer::LayerID::SymbolGrabAreas);
         else
             layer = nullptr;
         if (layer) {if (!layer->isVisible()) layer = nullptr;}
         painter->setBrush(layer ? QBrush(layer->getColor(selected), Qt::SolidPattern) : Qt::NoBrush);
 
-        // draw ellipse
-        painter->drawEllipse(ellipse->getCenter().toPxQPointF(), ellipse->getRadiusX().toPx(),
-                             ellipse->getRadiusY().toPx());
-        // TODO: rotation
+        // draw polygons/ellipses
+        painter->drawPath(group.path);
     }
 
     // draw all texts
@@ -231,7 +240,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         painter->translate(-text->getPosition().toPxQPointF());
         painter->scale(props.scaleFactor, props.scaleFactor);
         if (props.rotate180) painter->rotate(180);
-        if ((deviceIsPrinter) || (lod * text->getHeight().toPx() > 8))
+        if ((deviceIsPrinter) || (lod * text->getHeight().toPx() >= lodThresholds.textHeight))
         {
             // draw text
             painter->setPen(QPen(layer->getColor(selected), 0));
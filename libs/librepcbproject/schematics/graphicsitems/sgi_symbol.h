@@ -26,6 +26,8 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "sgi_base.h"
+#include <librepcbcommon/attributetexttemplate.h>
+#include <librepcbcommon/graphics/primitivepathcache.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -65,6 +67,16 @@ class SGI_Symbol final : public SGI_Base
         // General Methods
         void updateCacheAndRepaint() noexcept;
 
+        /**
+         * @brief Update the cache after attributes have changed
+         *
+         * Only the texts which depend on the changed attribute are evaluated again, and
+         * the cache is only rebuilt if at least one of them has changed.
+         *
+         * @param key   See IF_AttributeProvider#attributesChanged()
+         */
+        void updateAttributeTexts(const QString& key) noexcept;
+
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
         QPainterPath shape() const noexcept {return mShape;}
@@ -97,12 +109,14 @@ class SGI_Symbol final : public SGI_Base
         // General Attributes
         SI_Symbol& mSymbol;
         const library::Symbol& mLibSymbol;
+        QSharedPointer<const PrimitivePathCache> mPrimitiveCache; ///< shared by all instances
         QFont mFont;
 
         // Cached Attributes
         QRectF mBoundingRect;
         QPainterPath mShape;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+        QHash<const Text*, AttributeTextTemplate> mTextTemplates;
 };
 
 /*****************************************************************************************
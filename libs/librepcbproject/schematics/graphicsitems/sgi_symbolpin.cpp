@@ -47,7 +47,7 @@ namespace project {
  ****************************************************************************************/
 
 SGI_SymbolPin::SGI_SymbolPin(SI_SymbolPin& pin) noexcept :
-    SGI_Base(), mPin(pin), mLibPin(pin.getLibPin())
+    SGI_Base(pin), mPin(pin), mLibPin(pin.getLibPin())
 {
     setZValue(Schematic::ZValue_Symbols);
     setToolTip(mLibPin.getName());
@@ -75,6 +75,8 @@ SGI_SymbolPin::~SGI_SymbolPin() noexcept
 
 void SGI_SymbolPin::updateCacheAndRepaint() noexcept
 {
+    prepareGeometryChange();
+
     mShape = QPainterPath();
     mShape.setFillRule(Qt::WindingFill);
     mBoundingRect = QRectF();
@@ -33,13 +33,19 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+quint64 SI_Base::sAddedCounter = 0;
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 SI_Base::SI_Base(Schematic& schematic) noexcept :
     QObject(&schematic), mSchematic(schematic),
-    mIsAddedToSchematic(false), mIsSelected(false)
+    mIsAddedToSchematic(false), mIsSelected(false), mAddedOrder(0)
 {
 }
 
@@ -80,6 +86,7 @@ void SI_Base::addToSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
     Q_ASSERT(!mIsAddedToSchematic);
     scene.addItem(item);
     mIsAddedToSchematic = true;
+    mAddedOrder = ++sAddedCounter;
 }
 
 void SI_Base::removeFromSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
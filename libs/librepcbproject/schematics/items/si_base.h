@@ -79,6 +79,14 @@ class SI_Base : public QObject
         virtual bool isAddedToSchematic() const noexcept {return mIsAddedToSchematic;}
         virtual bool isSelected() const noexcept {return mIsSelected;}
 
+        /**
+         * @brief Get the order in which the items were added to the schematic
+         *
+         * Items which were added later have a higher number. This allows to sort items
+         * in the same order as the item lists of the schematic, without searching them.
+         */
+        quint64 getAddedOrder() const noexcept {return mAddedOrder;}
+
         // Setters
         virtual void setSelected(bool selected) noexcept;
 
@@ -107,6 +115,10 @@ class SI_Base : public QObject
         // General Attributes
         bool mIsAddedToSchematic;
         bool mIsSelected;
+        quint64 mAddedOrder; ///< see #getAddedOrder()
+
+        // Static Variables
+        static quint64 sAddedCounter; ///< the last assigned #mAddedOrder
 };
 
 /*****************************************************************************************
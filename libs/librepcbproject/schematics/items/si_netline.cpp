@@ -168,7 +168,7 @@ void SI_NetLine::removeFromSchematic(GraphicsScene& scene) throw (Exception)
 void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
 }
 
 XmlDomElement* SI_NetLine::serializeToXmlDomElement() const throw (Exception)
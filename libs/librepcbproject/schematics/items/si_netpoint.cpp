@@ -184,6 +184,7 @@ void SI_NetPoint::setPinToAttach(SI_SymbolPin* pin) throw (Exception)
     }
     mSymbolPin = pin;
     mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.invalidateConnectivity();
 }
 
 void SI_NetPoint::setPosition(const Point& position) noexcept
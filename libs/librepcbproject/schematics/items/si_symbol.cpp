@@ -137,7 +137,7 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
     if (newPos != mPosition) {
         mPosition = newPos;
         mGraphicsItem->setPos(newPos.toPxQPointF());
-        mGraphicsItem->updateCacheAndRepaint();
+        mGraphicsItem->scheduleCacheUpdate();
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -149,7 +149,7 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
     if (newRotation != mRotation) {
         mRotation = newRotation;
         mGraphicsItem->setRotation(-newRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        mGraphicsItem->scheduleCacheUpdate();
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -256,9 +256,9 @@ void SI_Symbol::setSelected(bool selected) noexcept
  *  Private Slots
  ****************************************************************************************/
 
-void SI_Symbol::schematicOrComponentAttributesChanged()
+void SI_Symbol::schematicOrComponentAttributesChanged(const QString& key)
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->updateAttributeTexts(key);
 }
 
 /*****************************************************************************************
@@ -110,13 +110,13 @@ class SI_Symbol final : public SI_Base, public IF_XmlSerializableObject,
 
     private slots:
 
-        void schematicOrComponentAttributesChanged();
+        void schematicOrComponentAttributesChanged(const QString& key);
 
 
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
 
     private:
@@ -30,6 +30,7 @@
 #include "si_netpoint.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include "../schematic.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
@@ -206,7 +207,7 @@ void SI_SymbolPin::updatePosition() noexcept
     mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
     mGraphicsItem->setPos(mPosition.toPxQPointF());
     mGraphicsItem->setRotation(-mRotation.toDeg());
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->scheduleCacheUpdate();
     if (mRegisteredNetPoint) {
         mRegisteredNetPoint->setPosition(mPosition);
     }
@@ -233,6 +234,10 @@ void SI_SymbolPin::setSelected(bool selected) noexcept
 
 void SI_SymbolPin::updateErcMessages() noexcept
 {
+    if (mSchematic.getProject().getErcMsgList().deferUpdate(*this)) {
+        return; // will be called again at the end of the current batch
+    }
+
     mErcMsgUnconnectedRequiredPin->setMsg(
         QString(tr("Unconnected pin: \"%1\" of symbol \"%2\""))
         .arg(getDisplayText(true, true)).arg(mSymbol.getName()));
@@ -99,7 +99,7 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
 
     private slots:
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
 
 
     private:
@@ -33,6 +33,8 @@
 #include "items/si_netpoint.h"
 #include "items/si_netline.h"
 #include "items/si_netlabel.h"
+#include "../circuit/netsignal.h"
+#include "graphicsitems/sgi_base.h"
 #include <librepcbcommon/graphics/graphicsview.h>
 #include <librepcbcommon/graphics/graphicsscene.h>
 #include <librepcbcommon/gridproperties.h>
@@ -48,10 +50,16 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
+Schematic::Schematic(Project& project, SmartXmlFile* xmlFile, const XmlDomDocument& doc) throw (Exception) :
+    Schematic(project, xmlFile->getFilepath(), false, false, false, QString(), xmlFile, &doc)
+{
+}
+
 Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
-                     bool readOnly, bool create, const QString& newName) throw (Exception):
+                     bool readOnly, bool create, const QString& newName,
+                     SmartXmlFile* xmlFile, const XmlDomDocument* doc) throw (Exception) :
     QObject(&project), IF_AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mXmlFile(xmlFile), mRevision(1), mIsAddedToProject(false), mConnectivityValid(false)
 {
     try
     {
@@ -71,8 +79,13 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
         }
         else
         {
-            mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
-            QSharedPointer<XmlDomDocument> doc = mXmlFile->parseFileAndBuildDomTree(true);
+            QSharedPointer<XmlDomDocument> parsedDoc;
+            if (!mXmlFile) {
+                mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
+                parsedDoc = mXmlFile->parseFileAndBuildDomTree(true);
+                doc = parsedDoc.data();
+            }
+            Q_ASSERT(doc);
             XmlDomElement& root = doc->getRoot();
 
             // the schematic seems to be ready to open, so we will create all needed objects
@@ -282,80 +295,106 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
 
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
 {
+    // The graphics scene returns the hit items in its own stacking order, so we collect
+    // them first and then build the list in the same order as the former linear scan
+    // over all items did: netpoints, netlines, netlabels and then symbols with their pins.
+    // The items of the same type are sorted by SI_Base#getAddedOrder(), which is the
+    // order of the item lists of the schematic.
     QPointF scenePosPx = pos.toPxQPointF();
-    QList<SI_Base*> list;   // Note: The order of adding the items is very important (the
-                            // top most item must appear as the first item in the list)!
-    // visible netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    QSet<SI_Base*> hits;
+    QMap<quint64, SI_Base*> netpoints, netlines, netlabels;
+    QMap<quint64, SI_Symbol*> symbols;
+    foreach (SI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (!netpoint->isVisible()) continue;
-        if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netpoint);
-    }
-    // hidden netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
-    {
-        if (netpoint->isVisible()) continue;
-        if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netpoint);
+        if (!item->getGrabAreaScenePx().contains(scenePosPx)) continue;
+        hits.insert(item);
+        switch (item->getType())
+        {
+            case SI_Base::Type_t::NetPoint:
+                netpoints.insert(item->getAddedOrder(), item);
+                break;
+            case SI_Base::Type_t::NetLine:
+                netlines.insert(item->getAddedOrder(), item);
+                break;
+            case SI_Base::Type_t::NetLabel:
+                netlabels.insert(item->getAddedOrder(), item);
+                break;
+            case SI_Base::Type_t::Symbol: {
+                SI_Symbol* symbol = static_cast<SI_Symbol*>(item);
+                symbols.insert(symbol->getAddedOrder(), symbol);
+                break;
+            }
+            case SI_Base::Type_t::SymbolPin: {
+                SI_Symbol* symbol = &static_cast<SI_SymbolPin*>(item)->getSymbol();
+                symbols.insert(symbol->getAddedOrder(), symbol);
+                break;
+            }
+            default: break;
+        }
     }
-    // netlines
-    foreach (SI_NetLine* netline, mNetLines)
+    QList<SI_Base*> list;   // Note: The order of adding the items is very important (the
+                            // top most item must appear as the first item in the list)!
+    foreach (SI_Base* netpoint, netpoints) // visible netpoints
     {
-        if (netline->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netline);
+        if (static_cast<SI_NetPoint*>(netpoint)->isVisible()) list.append(netpoint);
     }
-    // netlabels
-    foreach (SI_NetLabel* netlabel, mNetLabels)
+    foreach (SI_Base* netpoint, netpoints) // hidden netpoints
     {
-        if (netlabel->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netlabel);
+        if (!static_cast<SI_NetPoint*>(netpoint)->isVisible()) list.append(netpoint);
     }
-    // symbols & pins
-    foreach (SI_Symbol* symbol, mSymbols)
+    list.append(netlines.values());
+    list.append(netlabels.values());
+    foreach (SI_Symbol* symbol, symbols)
     {
         foreach (SI_SymbolPin* pin, symbol->getPins())
         {
-            if (pin->getGrabAreaScenePx().contains(scenePosPx))
-                list.append(pin);
+            if (hits.contains(pin)) list.append(pin);
         }
-        if (symbol->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(symbol);
+        if (hits.contains(symbol)) list.append(symbol);
     }
     return list;
 }
 
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<SI_NetPoint*> list;
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-            list.append(netpoint);
+        if ((item->getType() == SI_Base::Type_t::NetPoint)
+            && item->getGrabAreaScenePx().contains(scenePosPx))
+        {
+            list.append(static_cast<SI_NetPoint*>(item));
+        }
     }
     return list;
 }
 
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<SI_NetLine*> list;
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        if (netline->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-            list.append(netline);
+        if ((item->getType() == SI_Base::Type_t::NetLine)
+            && item->getGrabAreaScenePx().contains(scenePosPx))
+        {
+            list.append(static_cast<SI_NetLine*>(item));
+        }
     }
     return list;
 }
 
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const noexcept
 {
+    QPointF scenePosPx = pos.toPxQPointF();
     QList<SI_SymbolPin*> list;
-    foreach (SI_Symbol* symbol, mSymbols)
+    foreach (SI_Base* item, getIndexedItemsAtScenePos(scenePosPx))
     {
-        foreach (SI_SymbolPin* pin, symbol->getPins())
+        if ((item->getType() == SI_Base::Type_t::SymbolPin)
+            && item->getGrabAreaScenePx().contains(scenePosPx))
         {
-            if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-                list.append(pin);
+            list.append(static_cast<SI_SymbolPin*>(item));
         }
     }
     return list;
@@ -382,6 +421,7 @@ QList<SI_Base*> Schematic::getAllItems() const noexcept
 void Schematic::setGridProperties(const GridProperties& grid) noexcept
 {
     *mGridProperties = grid;
+    setModified();
 }
 
 /*****************************************************************************************
@@ -423,6 +463,7 @@ void Schematic::removeSymbol(SI_Symbol& symbol) throw (Exception)
     // remove from schematic
     symbol.removeFromSchematic(*mGraphicsScene); // can throw
     mSymbols.removeOne(&symbol);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -454,6 +495,7 @@ void Schematic::addNetPoint(SI_NetPoint& netpoint) throw (Exception)
     // add to schematic
     netpoint.addToSchematic(*mGraphicsScene); // can throw
     mNetPoints.append(&netpoint);
+    if (mConnectivityValid) addNetPointToConnectivity(netpoint);
 }
 
 void Schematic::removeNetPoint(SI_NetPoint& netpoint) throw (Exception)
@@ -464,6 +506,7 @@ void Schematic::removeNetPoint(SI_NetPoint& netpoint) throw (Exception)
     // remove from schematic
     netpoint.removeFromSchematic(*mGraphicsScene); // can throw an exception
     mNetPoints.removeOne(&netpoint);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -495,6 +538,7 @@ void Schematic::addNetLine(SI_NetLine& netline) throw (Exception)
     // add to schematic
     netline.addToSchematic(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    if (mConnectivityValid) addNetLineToConnectivity(netline);
 }
 
 void Schematic::removeNetLine(SI_NetLine& netline) throw (Exception)
@@ -505,6 +549,7 @@ void Schematic::removeNetLine(SI_NetLine& netline) throw (Exception)
     // remove from schematic
     netline.removeFromSchematic(*mGraphicsScene); // can throw
     mNetLines.removeOne(&netline);
+    invalidateConnectivity();
 }
 
 /*****************************************************************************************
@@ -548,6 +593,36 @@ void Schematic::removeNetLabel(SI_NetLabel& netlabel) throw (Exception)
     mNetLabels.removeOne(&netlabel);
 }
 
+/*****************************************************************************************
+ *  Connectivity Methods
+ ****************************************************************************************/
+
+bool Schematic::areItemsConnected(const SI_Base& item1, const SI_Base& item2) const noexcept
+{
+    const SI_Base* node1 = getConnectivityNode(item1);
+    const SI_Base* node2 = getConnectivityNode(item2);
+    if ((!node1) || (!node2)) return false;
+    if (node1 == node2) return true;
+    updateConnectivity();
+    return mConnectivity.areInSameSet(node1, node2);
+}
+
+bool Schematic::isNetSignalFullyConnected(const NetSignal& netsignal) const noexcept
+{
+    updateConnectivity();
+    const SI_Base* root = nullptr;
+    foreach (const SI_NetPoint* netpoint, netsignal.getSchematicNetPoints()) {
+        if (&netpoint->getSchematic() != this) continue;
+        const SI_Base* netpointRoot = mConnectivity.find(netpoint);
+        if (!root) {
+            root = netpointRoot;
+        } else if (netpointRoot != root) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -585,7 +660,7 @@ void Schematic::removeFromProject() throw (Exception)
     sgl.dismiss();
 }
 
-bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
+bool Schematic::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
@@ -594,9 +669,13 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
     {
         if (mIsAddedToProject)
         {
-            XmlDomDocument doc(*serializeToXmlDomElement());
-            doc.setFileVersion(APP_VERSION_MAJOR);
-            mXmlFile->save(doc, toOriginal);
+            if (!mXmlFile->tryUpdateToRevision(mRevision, toOriginal))
+            {
+                // the content was modified since the file was written the last time
+                QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+                doc->setFileVersion(APP_VERSION_MAJOR);
+                mXmlFile->save(doc, toOriginal, mRevision, writer);
+            }
         }
         else
         {
@@ -623,22 +702,25 @@ void Schematic::setSelectionRect(const Point& p1, const Point& p2, bool updateIt
     if (updateItems)
     {
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+        QSet<SI_Base*> itemsInRect;
+        foreach (SI_Base* item, getIndexedItemsInSceneRect(rectPx))
+        {
+            if (item->getGrabAreaScenePx().intersects(rectPx))
+                itemsInRect.insert(item);
+        }
         foreach (SI_Symbol* symbol, mSymbols)
         {
-            bool selectSymbol = symbol->getGrabAreaScenePx().intersects(rectPx);
+            bool selectSymbol = itemsInRect.contains(symbol);
             symbol->setSelected(selectSymbol);
             foreach (SI_SymbolPin* pin, symbol->getPins())
-            {
-                bool selectPin = pin->getGrabAreaScenePx().intersects(rectPx);
-                pin->setSelected(selectSymbol || selectPin);
-            }
+                pin->setSelected(selectSymbol || itemsInRect.contains(pin));
         }
         foreach (SI_NetPoint* netpoint, mNetPoints)
-            netpoint->setSelected(netpoint->getGrabAreaScenePx().intersects(rectPx));
+            netpoint->setSelected(itemsInRect.contains(netpoint));
         foreach (SI_NetLine* netline, mNetLines)
-            netline->setSelected(netline->getGrabAreaScenePx().intersects(rectPx));
+            netline->setSelected(itemsInRect.contains(netline));
         foreach (SI_NetLabel* netlabel, mNetLabels)
-            netlabel->setSelected(netlabel->getGrabAreaScenePx().intersects(rectPx));
+            netlabel->setSelected(itemsInRect.contains(netlabel));
     }
 }
 
@@ -656,6 +738,7 @@ void Schematic::clearSelection() const noexcept
 
 void Schematic::renderToQPainter(QPainter& painter) const noexcept
 {
+    mGraphicsScene->processScheduledCacheUpdates();
     mGraphicsScene->render(&painter, QRectF(), mGraphicsScene->itemsBoundingRect(), Qt::KeepAspectRatio);
 }
 
@@ -692,8 +775,81 @@ bool Schematic::getAttributeValue(const QString& attrNS, const QString& attrKey,
  *  Private Methods
  ****************************************************************************************/
 
+QList<SI_Base*> Schematic::getIndexedItemsAtScenePos(const QPointF& scenePosPx) const noexcept
+{
+    // The BSP tree of the graphics scene is maintained by Qt on every add/remove/move of
+    // the graphics items, so it serves as spatial index for all hit-tests.
+    mGraphicsScene->processScheduledCacheUpdates(); // geometry must be up to date
+    QList<SI_Base*> list;
+    foreach (QGraphicsItem* item, mGraphicsScene->items(scenePosPx, Qt::IntersectsItemBoundingRect))
+    {
+        SGI_Base* graphicsItem = dynamic_cast<SGI_Base*>(item);
+        if (graphicsItem) list.append(&graphicsItem->getSchematicItem());
+    }
+    return list;
+}
+
+QList<SI_Base*> Schematic::getIndexedItemsInSceneRect(const QRectF& sceneRectPx) const noexcept
+{
+    mGraphicsScene->processScheduledCacheUpdates(); // geometry must be up to date
+    QList<SI_Base*> list;
+    foreach (QGraphicsItem* item, mGraphicsScene->items(sceneRectPx, Qt::IntersectsItemBoundingRect))
+    {
+        SGI_Base* graphicsItem = dynamic_cast<SGI_Base*>(item);
+        if (graphicsItem) list.append(&graphicsItem->getSchematicItem());
+    }
+    return list;
+}
+
+const SI_Base* Schematic::getConnectivityNode(const SI_Base& item) const noexcept
+{
+    switch (item.getType())
+    {
+        case SI_Base::Type_t::NetPoint:
+        case SI_Base::Type_t::SymbolPin:
+            return &item;
+        case SI_Base::Type_t::NetLine: {
+            // a netline is always connected to its start (and end) point
+            const SI_NetLine* netline = dynamic_cast<const SI_NetLine*>(&item); Q_ASSERT(netline);
+            return &netline->getStartPoint();
+        }
+        default:
+            return nullptr;
+    }
+}
+
+void Schematic::addNetPointToConnectivity(const SI_NetPoint& netpoint) const noexcept
+{
+    if (netpoint.getSymbolPin()) {
+        mConnectivity.unite(&netpoint, netpoint.getSymbolPin());
+    } else {
+        mConnectivity.add(&netpoint);
+    }
+}
+
+void Schematic::addNetLineToConnectivity(const SI_NetLine& netline) const noexcept
+{
+    mConnectivity.unite(&netline.getStartPoint(), &netline.getEndPoint());
+}
+
+void Schematic::updateConnectivity() const noexcept
+{
+    if (mConnectivityValid) return;
+
+    // removing items is not possible with a disjoint set, so it is rebuilt from scratch
+    mConnectivity.clear();
+    foreach (const SI_NetPoint* netpoint, mNetPoints) {
+        addNetPointToConnectivity(*netpoint);
+    }
+    foreach (const SI_NetLine* netline, mNetLines) {
+        addNetLineToConnectivity(*netline);
+    }
+    mConnectivityValid = true;
+}
+
 void Schematic::updateIcon() noexcept
 {
+    mGraphicsScene->processScheduledCacheUpdates();
     QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
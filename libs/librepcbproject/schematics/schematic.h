@@ -31,6 +31,7 @@
 #include <librepcbcommon/units/all_length_units.h>
 #include <librepcbcommon/fileio/filepath.h>
 #include <librepcbcommon/exceptions.h>
+#include <librepcbcommon/disjointset.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -41,6 +42,8 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class SmartXmlFileWriter;
+class XmlDomDocument;
 
 namespace project {
 
@@ -105,6 +108,19 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         Schematic(const Schematic& other) = delete;
         Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly) throw (Exception) :
             Schematic(project, filepath, restore, readOnly, false, QString()) {}
+
+        /**
+         * @brief Load a schematic from a file which was already opened and parsed
+         *
+         * This allows to open and parse the (expensive) XML files in worker threads
+         * while the schematic objects are created in the main thread.
+         *
+         * @param project   The project of the schematic
+         * @param xmlFile   The opened schematic file (the ownership is transferred to the new
+         *                  schematic object, even if the constructor throws)
+         * @param doc       The parsed DOM tree of the file
+         */
+        Schematic(Project& project, SmartXmlFile* xmlFile, const XmlDomDocument& doc) throw (Exception);
         ~Schematic() noexcept;
 
         // Getters: General
@@ -157,10 +173,35 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         void addNetLabel(SI_NetLabel& netlabel) throw (Exception);
         void removeNetLabel(SI_NetLabel& netlabel) throw (Exception);
 
+        // Connectivity Methods
+
+        /**
+         * @brief Check whether two items are electrically connected by wires
+         *
+         * Only netpoints, netlines and symbol pins can be connected, for all other items
+         * this method returns false. Connections by net labels are not taken into account.
+         */
+        bool areItemsConnected(const SI_Base& item1, const SI_Base& item2) const noexcept;
+
+        /**
+         * @brief Check whether all netpoints of a netsignal in this schematic are connected
+         *        together by wires (i.e. without the need of net labels)
+         */
+        bool isNetSignalFullyConnected(const NetSignal& netsignal) const noexcept;
+
+        /**
+         * @brief Mark the connectivity as outdated (it is rebuilt on the next query)
+         *
+         * This is called automatically if an item is removed from the schematic or if a
+         * netpoint gets attached to or detached from a symbol pin.
+         */
+        void invalidateConnectivity() noexcept {mConnectivityValid = false;}
+
         // General Methods
         void addToProject() throw (Exception);
         void removeFromProject() throw (Exception);
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        void setModified() noexcept {++mRevision;}
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer = nullptr) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
@@ -185,14 +226,21 @@ class Schematic final : public QObject, public IF_AttributeProvider,
     signals:
 
         /// @copydoc IF_AttributeProvider#attributesChanged()
-        void attributesChanged();
+        void attributesChanged(const QString& key = QString());
 
 
     private:
 
         Schematic(Project& project, const FilePath& filepath, bool restore,
-                  bool readOnly, bool create, const QString& newName) throw (Exception);
+                  bool readOnly, bool create, const QString& newName,
+                  SmartXmlFile* xmlFile = nullptr, const XmlDomDocument* doc = nullptr) throw (Exception);
         void updateIcon() noexcept;
+        QList<SI_Base*> getIndexedItemsAtScenePos(const QPointF& scenePosPx) const noexcept;
+        QList<SI_Base*> getIndexedItemsInSceneRect(const QRectF& sceneRectPx) const noexcept;
+        const SI_Base* getConnectivityNode(const SI_Base& item) const noexcept;
+        void addNetPointToConnectivity(const SI_NetPoint& netpoint) const noexcept;
+        void addNetLineToConnectivity(const SI_NetLine& netline) const noexcept;
+        void updateConnectivity() const noexcept;
 
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
@@ -205,6 +253,7 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         Project& mProject; ///< A reference to the Project object (from the ctor)
         FilePath mFilePath; ///< the filepath of the schematic *.xml file (from the ctor)
         QScopedPointer<SmartXmlFile> mXmlFile;
+        quint64 mRevision; ///< incremented on every modification, see #setModified()
         bool mIsAddedToProject;
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
@@ -220,6 +269,10 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         QList<SI_NetPoint*> mNetPoints;
         QList<SI_NetLine*> mNetLines;
         QList<SI_NetLabel*> mNetLabels;
+
+        // connectivity (each set contains all netpoints/pins connected by wires)
+        mutable DisjointSet<const SI_Base*> mConnectivity;
+        mutable bool mConnectivityValid; ///< if false, #mConnectivity must be rebuilt
 };
 
 /*****************************************************************************************
@@ -81,12 +81,14 @@ bool CmdProjectSettingsChange::performExecute() throw (Exception)
 
 void CmdProjectSettingsChange::performUndo() throw (Exception)
 {
+    mSettings.setModified();
     applyOldSettings(); // can throw
     mSettings.triggerSettingsChanged();
 }
 
 void CmdProjectSettingsChange::performRedo() throw (Exception)
 {
+    mSettings.setModified();
     applyNewSettings(); // can throw
     mSettings.triggerSettingsChanged();
 }
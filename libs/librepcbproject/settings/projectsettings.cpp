@@ -39,7 +39,8 @@ namespace project {
 
 ProjectSettings::ProjectSettings(Project& project, bool restore, bool readOnly, bool create) throw (Exception) :
     QObject(nullptr), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/settings.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/settings.xml")), mXmlFile(nullptr),
+    mRevision(1)
 {
     qDebug() << "load settings...";
     Q_ASSERT(!(create && (restore || readOnly)));
@@ -111,16 +112,20 @@ void ProjectSettings::triggerSettingsChanged() noexcept
     emit settingsChanged();
 }
 
-bool ProjectSettings::save(bool toOriginal, QStringList& errors) noexcept
+bool ProjectSettings::save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer) noexcept
 {
     bool success = true;
 
     // Save "core/settings.xml"
     try
     {
-        XmlDomDocument doc(*serializeToXmlDomElement());
-        doc.setFileVersion(APP_VERSION_MAJOR);
-        mXmlFile->save(doc, toOriginal);
+        if (!mXmlFile->tryUpdateToRevision(mRevision, toOriginal))
+        {
+            // the content was modified since the file was written the last time
+            QSharedPointer<XmlDomDocument> doc(new XmlDomDocument(*serializeToXmlDomElement()));
+            doc->setFileVersion(APP_VERSION_MAJOR);
+            mXmlFile->save(doc, toOriginal, mRevision, writer);
+        }
     }
     catch (Exception& e)
     {
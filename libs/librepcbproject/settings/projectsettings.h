@@ -33,6 +33,7 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartXmlFileWriter;
 
 namespace project {
 
@@ -72,7 +73,8 @@ class ProjectSettings final : public QObject, public IF_XmlSerializableObject
         // General Methods
         void restoreDefaults() noexcept;
         void triggerSettingsChanged() noexcept;
-        bool save(bool toOriginal, QStringList& errors) noexcept;
+        void setModified() noexcept {++mRevision;}
+        bool save(bool toOriginal, QStringList& errors, SmartXmlFileWriter* writer = nullptr) noexcept;
 
 
     signals:
@@ -103,6 +105,7 @@ class ProjectSettings final : public QObject, public IF_XmlSerializableObject
         // File "core/settings.xml"
         FilePath mXmlFilepath;
         SmartXmlFile* mXmlFile;
+        quint64 mRevision; ///< incremented on every modification, see #setModified()
 
 
         // All Settings
@@ -38,7 +38,7 @@
 #include <librepcbcommon/gridproperties.h>
 #include <librepcbworkspace/workspace.h>
 #include "../projecteditor.h"
-#include <librepcblibrary/pkg/footprintpreviewgraphicsitem.h>
+#include <librepcblibrary/previewthumbnailcache.h>
 #include <librepcbproject/boards/boardlayerstack.h>
 #include "../cmd/cmdadddevicetoboard.h"
 
@@ -65,6 +65,9 @@ UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor) :
     mUi->graphicsView->setBackgroundBrush(QBrush(Qt::black, Qt::SolidPattern));
     mUi->graphicsView->setOriginCrossVisible(false);
     mUi->graphicsView->setScene(mFootprintPreviewGraphicsScene);
+    connect(&mProjectEditor.getWorkspace().getPreviewThumbnailCache(),
+            &library::PreviewThumbnailCache::thumbnailReady,
+            this, &UnplacedComponentsDock::updateFootprintPreview);
 
     QSettings clientSettings;
     mUi->splitter->restoreState(clientSettings.value("unplaced_components_dock/splitter_state").toByteArray());
@@ -86,7 +89,7 @@ UnplacedComponentsDock::~UnplacedComponentsDock()
     mDisableListUpdate = true;
     disconnect(mCircuitConnection1);        mCircuitConnection1 = QMetaObject::Connection();
     disconnect(mCircuitConnection2);        mCircuitConnection2 = QMetaObject::Connection();
-    delete mFootprintPreviewGraphicsItem;   mFootprintPreviewGraphicsItem = nullptr;
+    mFootprintPreviewGraphicsItem = nullptr; // deleted by the scene
     delete mFootprintPreviewGraphicsScene;  mFootprintPreviewGraphicsScene = nullptr;
     delete mUi;                             mUi = nullptr;
 }
@@ -320,24 +323,33 @@ void UnplacedComponentsDock::setSelectedDeviceAndPackage(const library::Device*
 void UnplacedComponentsDock::setSelectedFootprintUuid(const Uuid& uuid) noexcept
 {
     mUi->btnAdd->setEnabled(false);
-    if (mFootprintPreviewGraphicsItem) {
-        mFootprintPreviewGraphicsScene->removeItem(*mFootprintPreviewGraphicsItem);
-        delete mFootprintPreviewGraphicsItem; mFootprintPreviewGraphicsItem = nullptr;
-    }
     mSelectedFootprintUuid = uuid;
 
     if (mBoard && mSelectedComponent && mSelectedDevice && mSelectedPackage && (!mSelectedFootprintUuid.isNull()))
     {
-        const library::Footprint* fpt = mSelectedPackage->getFootprintByUuid(mSelectedFootprintUuid);
-        if (fpt) {
-            mFootprintPreviewGraphicsItem = new library::FootprintPreviewGraphicsItem(
-                mBoard->getLayerStack(), mProject.getSettings().getLocaleOrder(), *fpt,
-                mSelectedPackage, &mSelectedComponent->getLibComponent(), mSelectedComponent);
-            mFootprintPreviewGraphicsScene->addItem(*mFootprintPreviewGraphicsItem);
-            mUi->graphicsView->zoomAll();
+        if (mSelectedPackage->getFootprintByUuid(mSelectedFootprintUuid)) {
             mUi->btnAdd->setEnabled(true);
         }
     }
+
+    updateFootprintPreview();
+}
+
+void UnplacedComponentsDock::updateFootprintPreview() noexcept
+{
+    delete mFootprintPreviewGraphicsItem;
+    mFootprintPreviewGraphicsItem = nullptr;
+    if (!mUi->btnAdd->isEnabled()) return; // no valid footprint selected
+
+    // if the thumbnail is not cached yet, it is rendered in background and this method
+    // gets called again by the signal thumbnailReady()
+    QPixmap thumbnail = mProjectEditor.getWorkspace().getPreviewThumbnailCache().
+        getFootprintThumbnail(*mSelectedPackage, mSelectedFootprintUuid,
+                              mProject.getSettings().getLocaleOrder());
+    if (thumbnail.isNull()) return;
+    mFootprintPreviewGraphicsItem = mFootprintPreviewGraphicsScene->addPixmap(thumbnail);
+    mFootprintPreviewGraphicsItem->setTransformationMode(Qt::SmoothTransformation);
+    mUi->graphicsView->zoomAll();
 }
 
 void UnplacedComponentsDock::beginUndoCmdGroup() noexcept
@@ -40,7 +40,6 @@ namespace library {
 class Device;
 class Package;
 class Footprint;
-class FootprintPreviewGraphicsItem;
 }
 
 namespace project {
@@ -90,6 +89,7 @@ class UnplacedComponentsDock final : public QDockWidget
         void on_btnAdd_clicked();
         void on_pushButton_clicked();
         void on_btnAddAll_clicked();
+        void updateFootprintPreview() noexcept;
 
 
     private:
@@ -117,7 +117,7 @@ class UnplacedComponentsDock final : public QDockWidget
         Board* mBoard;
         Ui::UnplacedComponentsDock* mUi;
         GraphicsScene* mFootprintPreviewGraphicsScene;
-        library::FootprintPreviewGraphicsItem* mFootprintPreviewGraphicsItem;
+        QGraphicsPixmapItem* mFootprintPreviewGraphicsItem; ///< the footprint thumbnail
         ComponentInstance* mSelectedComponent;
         const library::Device* mSelectedDevice;
         const library::Package* mSelectedPackage;
@@ -85,6 +85,18 @@ CmdMoveSelectedBoardItems::~CmdMoveSelectedBoardItems() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdMoveSelectedBoardItems::getEstimatedMemorySize() const noexcept
+{
+    // after the execution, the edit commands are children of this group and thus
+    // already counted by UndoCommandGroup, only our own references to them remain
+    qint64 count = mDeviceEditCmds.count() + mViaEditCmds.count() + mNetPointEditCmds.count();
+    return UndoCommandGroup::getEstimatedMemorySize() + count * sizeof(void*);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -53,6 +53,11 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
         CmdMoveSelectedBoardItems(Board& board, const Point& startPos) noexcept;
         ~CmdMoveSelectedBoardItems() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getEstimatedMemorySize()
+        qint64 getEstimatedMemorySize() const noexcept override;
+
         // General Methods
         void setCurrentPosition(const Point& pos) noexcept;
 
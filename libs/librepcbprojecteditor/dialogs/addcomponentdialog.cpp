@@ -30,9 +30,8 @@
 #include <librepcbproject/library/projectlibrary.h>
 #include <librepcblibrary/cmp/component.h>
 #include <librepcblibrary/cmp/componentsymbolvariant.h>
-#include <librepcblibrary/sym/symbol.h>
 #include <librepcbproject/settings/projectsettings.h>
-#include <librepcblibrary/sym/symbolpreviewgraphicsitem.h>
+#include <librepcblibrary/previewthumbnailcache.h>
 #include <librepcbworkspace/workspace.h>
 #include <librepcbworkspace/settings/workspacesettings.h>
 #include <librepcblibrary/cat/categorytreemodel.h>
@@ -54,13 +53,16 @@ namespace project {
 AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace, Project& project,
                                        QWidget* parent) :
     QDialog(parent), mWorkspace(workspace), mProject(project),
-    mUi(new Ui::AddComponentDialog), mPreviewScene(nullptr), mCategoryTreeModel(nullptr),
+    mUi(new Ui::AddComponentDialog), mPreviewScene(nullptr), mPreviewPixmapItem(nullptr),
+    mCategoryTreeModel(nullptr), mSearchTimer(nullptr),
     mSelectedComponent(nullptr), mSelectedSymbVar(nullptr)
 {
     mUi->setupUi(this);
     mPreviewScene = new GraphicsScene();
     mUi->graphicsView->setScene(mPreviewScene);
     mUi->graphicsView->setOriginCrossVisible(false);
+    connect(&mWorkspace.getPreviewThumbnailCache(), &library::PreviewThumbnailCache::thumbnailReady,
+            this, &AddComponentDialog::updatePreview);
 
     const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
     mCategoryTreeModel = new library::CategoryTreeModel(mWorkspace.getLibrary(), localeOrder);
@@ -68,15 +70,20 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace, Project&
     connect(mUi->treeCategories->selectionModel(), &QItemSelectionModel::currentChanged,
             this, &AddComponentDialog::treeCategories_currentItemChanged);
 
+    mSearchTimer = new QTimer(this);
+    mSearchTimer->setSingleShot(true);
+    mSearchTimer->setInterval(sSearchDelayMs);
+    connect(mSearchTimer, &QTimer::timeout, this, &AddComponentDialog::searchTimerTimeout);
+
     //setSelectedCategory(Uuid());
 }
 
 AddComponentDialog::~AddComponentDialog() noexcept
 {
-    qDeleteAll(mPreviewSymbolGraphicsItems);    mPreviewSymbolGraphicsItems.clear();
     mSelectedSymbVar = nullptr;
     delete mSelectedComponent;                  mSelectedComponent = nullptr;
     delete mCategoryTreeModel;                  mCategoryTreeModel = nullptr;
+    mPreviewPixmapItem = nullptr; // deleted by the scene
     delete mPreviewScene;                       mPreviewScene = nullptr;
     delete mUi;                                 mUi = nullptr;
 }
@@ -120,6 +127,24 @@ void AddComponentDialog::treeCategories_currentItemChanged(const QModelIndex& cu
     }
 }
 
+void AddComponentDialog::on_edtSearch_textChanged(const QString& text)
+{
+    Q_UNUSED(text);
+    mSearchTimer->start(); // (re)start the delay, the search is executed on timeout
+}
+
+void AddComponentDialog::searchTimerTimeout() noexcept
+{
+    try
+    {
+        updateComponentList();
+    }
+    catch (Exception& e)
+    {
+        QMessageBox::critical(this, tr("Error"), e.getUserMsg());
+    }
+}
+
 void AddComponentDialog::on_listComponents_currentItemChanged(QListWidgetItem *current, QListWidgetItem *previous)
 {
     Q_UNUSED(previous);
@@ -157,24 +182,48 @@ void AddComponentDialog::on_cbxSymbVar_currentIndexChanged(int index)
 
 void AddComponentDialog::setSelectedCategory(const Uuid& categoryUuid)
 {
-    if ((categoryUuid == mSelectedCategoryUuid) && (!categoryUuid.isNull())) return;
+    if ((categoryUuid == mSelectedCategoryUuid) && (!categoryUuid.isNull()) &&
+        (mUi->edtSearch->text().isEmpty())) return;
+
+    // selecting a category ends the search
+    mSelectedCategoryUuid = categoryUuid;
+    mSearchTimer->stop();
+    {
+        QSignalBlocker blocker(mUi->edtSearch);
+        mUi->edtSearch->clear();
+    }
+    updateComponentList();
+}
 
+void AddComponentDialog::updateComponentList()
+{
     setSelectedComponent(nullptr);
     mUi->listComponents->clear();
     //mUi->listComponents->setEnabled(false);
 
     const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
 
-    mSelectedCategoryUuid = categoryUuid;
-    QSet<Uuid> components = mWorkspace.getLibrary().getComponentsByCategory(categoryUuid);
+    // show either the search results (best match first) or the selected category
+    QList<Uuid> components;
+    QString searchText = mUi->edtSearch->text().trimmed();
+    if (!searchText.isEmpty()) {
+        components = mWorkspace.getLibrary().searchComponents(searchText, localeOrder,
+                                                              sMaxSearchResults);
+    } else {
+        components = mWorkspace.getLibrary().getComponentsByCategory(mSelectedCategoryUuid).toList();
+    }
+    mUi->listComponents->setSortingEnabled(searchText.isEmpty());
+
+    // the list is built from the library database only, without parsing any XML files
+    QHash<Uuid, library::Library::ElementSummary> summaries =
+        mWorkspace.getLibrary().getComponentSummaries(components, localeOrder);
     foreach (const Uuid& cmpUuid, components)
     {
-        FilePath cmpFp = mWorkspace.getLibrary().getLatestComponent(cmpUuid);
-        if (!cmpFp.isValid()) continue;
-        library::Component component(cmpFp, true); // TODO: use library metadata instead of loading the whole component
-
-        QListWidgetItem* item = new QListWidgetItem(component.getName(localeOrder));
-        item->setData(Qt::UserRole, cmpFp.toStr());
+        if (!summaries.contains(cmpUuid)) continue;
+        const library::Library::ElementSummary& summary = summaries[cmpUuid];
+        QListWidgetItem* item = new QListWidgetItem(summary.name);
+        item->setToolTip(summary.description);
+        item->setData(Qt::UserRole, summary.filepath.toStr());
         mUi->listComponents->addItem(item);
     }
 }
@@ -220,8 +269,6 @@ void AddComponentDialog::setSelectedComponent(const library::Component* cmp)
 void AddComponentDialog::setSelectedSymbVar(const library::ComponentSymbolVariant* symbVar)
 {
     if (symbVar == mSelectedSymbVar) return;
-    qDeleteAll(mPreviewSymbolGraphicsItems);
-    mPreviewSymbolGraphicsItems.clear();
     mUi->lblSymbVarUuid->setText(QString("00000000-0000-0000-0000-000000000000"));
     mUi->lblSymbVarNorm->setText(QString("-"));
     mUi->lblSymbVarDescription->setText(QString("-"));
@@ -234,26 +281,26 @@ void AddComponentDialog::setSelectedSymbVar(const library::ComponentSymbolVarian
         mUi->lblSymbVarUuid->setText(symbVar->getUuid().toStr());
         mUi->lblSymbVarNorm->setText(symbVar->getNorm());
         mUi->lblSymbVarDescription->setText(symbVar->getDescription(localeOrder));
-
-        for (int i = 0; i < symbVar->getItemCount(); i++) {
-            const library::ComponentSymbolVariantItem* item = symbVar->getItem(i);
-            Q_ASSERT(item); if (!item) continue;
-
-            FilePath symbolFp = mWorkspace.getLibrary().getLatestSymbol(item->getSymbolUuid());
-            if (!symbolFp.isValid()) continue; // TODO: show warning
-            const library::Symbol* symbol = new library::Symbol(symbolFp, true); // TODO: fix memory leak...
-            library::SymbolPreviewGraphicsItem* graphicsItem = new library::SymbolPreviewGraphicsItem(
-                mProject, localeOrder, *symbol, mSelectedComponent, symbVar->getUuid(), item->getUuid());
-            //graphicsItem->setDrawBoundingRect(mProject.getWorkspace().getSettings().getDebugTools()->getShowGraphicsItemsBoundingRect());
-            mPreviewSymbolGraphicsItems.append(graphicsItem);
-            Point pos = Point::fromPx(0, mPreviewScene->itemsBoundingRect().bottom()
-                                      + graphicsItem->boundingRect().height(),
-                                      mUi->graphicsView->getGridProperties().getInterval());
-            graphicsItem->setPos(pos.toPxQPointF());
-            mPreviewScene->addItem(*graphicsItem);
-            mUi->graphicsView->zoomAll();
-        }
     }
+
+    updatePreview();
+}
+
+void AddComponentDialog::updatePreview() noexcept
+{
+    delete mPreviewPixmapItem;
+    mPreviewPixmapItem = nullptr;
+    if ((!mSelectedComponent) || (!mSelectedSymbVar)) return;
+
+    // the thumbnail is rendered in background if it is not cached yet, this method will
+    // be called again (by the signal thumbnailReady()) as soon as it is available
+    const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
+    QPixmap thumbnail = mWorkspace.getPreviewThumbnailCache().getSymbolVariantThumbnail(
+        *mSelectedComponent, mSelectedSymbVar->getUuid(), localeOrder);
+    if (thumbnail.isNull()) return;
+    mPreviewPixmapItem = mPreviewScene->addPixmap(thumbnail);
+    mPreviewPixmapItem->setTransformationMode(Qt::SmoothTransformation);
+    mUi->graphicsView->zoomAll();
 }
 
 void AddComponentDialog::accept() noexcept
@@ -39,8 +39,6 @@ class GraphicsScene;
 namespace library {
 class Component;
 class ComponentSymbolVariant;
-class Symbol;
-class SymbolPreviewGraphicsItem;
 class CategoryTreeModel;
 class ComponentCategory;
 }
@@ -88,14 +86,18 @@ class AddComponentDialog final : public QDialog
     private slots:
 
         void treeCategories_currentItemChanged(const QModelIndex& current, const QModelIndex& previous);
+        void on_edtSearch_textChanged(const QString& text);
+        void searchTimerTimeout() noexcept;
         void on_listComponents_currentItemChanged(QListWidgetItem *current, QListWidgetItem *previous);
         void on_cbxSymbVar_currentIndexChanged(int index);
+        void updatePreview() noexcept;
 
 
     private:
 
         // Private Methods
         void setSelectedCategory(const Uuid& categoryUuid);
+        void updateComponentList();
         void setSelectedComponent(const library::Component* cmp);
         void setSelectedSymbVar(const library::ComponentSymbolVariant* symbVar);
         void accept() noexcept;
@@ -106,14 +108,19 @@ class AddComponentDialog final : public QDialog
         Project& mProject;
         Ui::AddComponentDialog* mUi;
         GraphicsScene* mPreviewScene;
+        QGraphicsPixmapItem* mPreviewPixmapItem; ///< the thumbnail of the symbol variant
         library::CategoryTreeModel* mCategoryTreeModel;
+        QTimer* mSearchTimer; ///< delays the search until the user stops typing
 
 
         // Attributes
         Uuid mSelectedCategoryUuid;
         const library::Component* mSelectedComponent;
         const library::ComponentSymbolVariant* mSelectedSymbVar;
-        QList<library::SymbolPreviewGraphicsItem*> mPreviewSymbolGraphicsItems;
+
+        // Static Variables
+        static constexpr int sMaxSearchResults = 200;
+        static constexpr int sSearchDelayMs = 200;
 };
 
 /*****************************************************************************************
@@ -102,11 +102,14 @@ ErcMsgDock::ErcMsgDock(Project& project) :
         child->setToolTip(0, ercMsg->getMsg());
         mErcMsgItems.insert(ercMsg, child);
     }
+    foreach (QTreeWidgetItem* topLevelItem, mTopLevelItems)
+        topLevelItem->sortChildren(0, Qt::AscendingOrder); // the list is not ordered
 
     // connect to ErcMsgList signals
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgAdded,    this, &ErcMsgDock::ercMsgAdded);
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgRemoved,  this, &ErcMsgDock::ercMsgRemoved);
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgChanged,  this, &ErcMsgDock::ercMsgChanged);
+    connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgsChanged, this, &ErcMsgDock::ercMsgsChanged);
 
     updateTopLevelItemTexts();
 }
@@ -122,18 +125,9 @@ ErcMsgDock::~ErcMsgDock()
 
 void ErcMsgDock::ercMsgAdded(ErcMsg* ercMsg) noexcept
 {
-    QTreeWidgetItem* parent;
-    Q_ASSERT(ercMsg);
-    Q_ASSERT(!mErcMsgItems.contains(ercMsg));
-    if (!ercMsg->isIgnored())
-        parent = mTopLevelItems.value(static_cast<int>(ercMsg->getMsgType()), 0);
-    else
-        parent = mTopLevelItems.value(static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
-    Q_ASSERT(parent); if (!parent) return;
-    QTreeWidgetItem* child = new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
-    child->setToolTip(0, ercMsg->getMsg());
+    QTreeWidgetItem* parent = addErcMsgItem(ercMsg);
+    if (!parent) return;
     parent->sortChildren(0, Qt::AscendingOrder);
-    mErcMsgItems.insert(ercMsg, child);
     updateTopLevelItemTexts();
 }
 
@@ -151,6 +145,31 @@ void ErcMsgDock::ercMsgChanged(ErcMsg* ercMsg) noexcept
     ercMsgAdded(ercMsg);
 }
 
+void ErcMsgDock::ercMsgsChanged(const QList<ErcMsg*>& added, const QList<ErcMsg*>& removed,
+                                const QList<ErcMsg*>& changed) noexcept
+{
+    mUi->treeWidget->setUpdatesEnabled(false);
+
+    // note: the removed messages may already be deleted, so don't dereference them!
+    foreach (ErcMsg* ercMsg, removed + changed) {
+        Q_ASSERT(mErcMsgItems.contains(ercMsg));
+        delete mErcMsgItems.take(ercMsg);
+    }
+
+    // add new items and sort each modified top-level item only once
+    QSet<QTreeWidgetItem*> modifiedParents;
+    foreach (ErcMsg* ercMsg, added + changed) {
+        QTreeWidgetItem* parent = addErcMsgItem(ercMsg);
+        if (parent) modifiedParents.insert(parent);
+    }
+    foreach (QTreeWidgetItem* parent, modifiedParents) {
+        parent->sortChildren(0, Qt::AscendingOrder);
+    }
+
+    updateTopLevelItemTexts();
+    mUi->treeWidget->setUpdatesEnabled(true);
+}
+
 /*****************************************************************************************
  *  GUI Actions
  ****************************************************************************************/
@@ -194,6 +213,22 @@ void ErcMsgDock::on_btnIgnore_clicked(bool checked)
  *  Private Methods
  ****************************************************************************************/
 
+QTreeWidgetItem* ErcMsgDock::addErcMsgItem(ErcMsg* ercMsg) noexcept
+{
+    QTreeWidgetItem* parent;
+    Q_ASSERT(ercMsg);
+    Q_ASSERT(!mErcMsgItems.contains(ercMsg));
+    if (!ercMsg->isIgnored())
+        parent = mTopLevelItems.value(static_cast<int>(ercMsg->getMsgType()), 0);
+    else
+        parent = mTopLevelItems.value(static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
+    Q_ASSERT(parent); if (!parent) return nullptr;
+    QTreeWidgetItem* child = new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
+    child->setToolTip(0, ercMsg->getMsg());
+    mErcMsgItems.insert(ercMsg, child);
+    return parent;
+}
+
 void ErcMsgDock::updateTopLevelItemTexts() noexcept
 {
     int countOfNonIgnoredErcMessages = 0;
@@ -63,6 +63,8 @@ class ErcMsgDock final : public QDockWidget
         void ercMsgAdded(ErcMsg* ercMsg) noexcept;
         void ercMsgRemoved(ErcMsg* ercMsg) noexcept;
         void ercMsgChanged(ErcMsg* ercMsg) noexcept;
+        void ercMsgsChanged(const QList<ErcMsg*>& added, const QList<ErcMsg*>& removed,
+                            const QList<ErcMsg*>& changed) noexcept;
 
 
     private slots:
@@ -75,6 +77,7 @@ class ErcMsgDock final : public QDockWidget
     private:
 
         // Private Methods
+        QTreeWidgetItem* addErcMsgItem(ErcMsg* ercMsg) noexcept;
         void updateTopLevelItemTexts() noexcept;
 
         // make some methods inaccessible...
@@ -23,9 +23,11 @@
 #include <QtCore>
 #include "projecteditor.h"
 #include <librepcbcommon/undostack.h>
+#include <librepcbcommon/fileio/smartxmlfilewriter.h>
 #include <librepcbworkspace/workspace.h>
 #include <librepcbworkspace/settings/workspacesettings.h>
 #include <librepcbproject/project.h>
+#include <librepcbproject/erc/ercmsglist.h>
 #include "schematiceditor/schematiceditor.h"
 #include "boardeditor/boardeditor.h"
 #include "dialogs/projectsettingsdialog.h"
@@ -42,12 +44,24 @@ namespace project {
  ****************************************************************************************/
 
 ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project) throw (Exception) :
-    QObject(nullptr), mWorkspace(workspace), mProject(project), mUndoStack(nullptr),
-    mSchematicEditor(nullptr), mBoardEditor(nullptr)
+    QObject(nullptr), mWorkspace(workspace), mProject(project), mAutosaveWriter(nullptr),
+    mUndoStack(nullptr), mSchematicEditor(nullptr), mBoardEditor(nullptr)
 {
     try
     {
+        mAutosaveWriter = new SmartXmlFileWriter(this);
+        connect(mAutosaveWriter, &SmartXmlFileWriter::finished,
+                this, &ProjectEditor::autosaveFinished);
         mUndoStack = new UndoStack();
+        const workspace::WSI_ProjectUndoStackLimits* undoLimits =
+            mWorkspace.getSettings().getProjectUndoStackLimits();
+        mUndoStack->setLimits(undoLimits->getMaxCommandCount(), undoLimits->getMaxMemorySize());
+
+        // recalculate the ERC messages only once per command
+        connect(mUndoStack, &UndoStack::transactionStarted,
+                &mProject.getErcMsgList(), &ErcMsgList::beginBatch);
+        connect(mUndoStack, &UndoStack::transactionFinished,
+                &mProject.getErcMsgList(), &ErcMsgList::endBatch);
 
         // create the whole schematic/board editor GUI inclusive FSM and so on
         mSchematicEditor = new SchematicEditor(*this, mProject);
@@ -59,6 +73,7 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
         delete mBoardEditor;            mBoardEditor = nullptr;
         delete mSchematicEditor;        mSchematicEditor = nullptr;
         delete mUndoStack;              mUndoStack = nullptr;
+        delete mAutosaveWriter;         mAutosaveWriter = nullptr;
         throw; // ...and rethrow the exception
     }
 
@@ -74,8 +89,11 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
 
 ProjectEditor::~ProjectEditor() noexcept
 {
-    // stop the autosave timer
+    // stop the autosave timer and wait until the last autosave is written
     mAutoSaveTimer.stop();
+    mAutosaveWriter->disconnect(this);
+    QStringList autosaveErrors;
+    mAutosaveWriter->waitForFinished(autosaveErrors);
 
     // abort all active commands!
     mSchematicEditor->abortAllCommands();
@@ -91,6 +109,7 @@ ProjectEditor::~ProjectEditor() noexcept
     delete mBoardEditor;            mBoardEditor = nullptr;
     delete mSchematicEditor;        mSchematicEditor = nullptr;
     delete mUndoStack;              mUndoStack = nullptr;
+    delete mAutosaveWriter;         mAutosaveWriter = nullptr;
 
     // emit "project editor closed" signal
     emit projectEditorClosed();
@@ -156,6 +175,11 @@ void ProjectEditor::execNetClassesEditorDialog(QWidget* parent) noexcept
 
 bool ProjectEditor::saveProject() noexcept
 {
+    // a running autosave must be finished first, otherwise it could overwrite the
+    // temporary files with older content (errors are irrelevant, we save again anyway)
+    QStringList autosaveErrors;
+    mAutosaveWriter->waitForFinished(autosaveErrors);
+
     try
     {
         // step 1: save whole project to temporary files
@@ -183,6 +207,9 @@ bool ProjectEditor::autosaveProject() noexcept
     if ((!mProject.isRestored()) && (mUndoStack->isClean()))
         return false; // do not save if there are no changes
 
+    if (mAutosaveWriter->isRunning())
+        return false; // the last autosave is not finished yet, try it next time
+
     if (mUndoStack->isCommandGroupActive())
     {
         // the user is executing a command at the moment, so we should not save now,
@@ -198,12 +225,15 @@ bool ProjectEditor::autosaveProject() noexcept
     try
     {
         qDebug() << "Begin autosaving the project to temporary files...";
-        mProject.save(false);
-        qDebug() << "Project successfully autosaved";
+        mProject.save(false, mAutosaveWriter); // only serializes the project
+        mAutosaveWriter->start(); // write the files in a worker thread
+        showStatusBarMessage(tr("Autosaving project..."));
         return true;
     }
     catch (Exception& exc)
     {
+        mAutosaveWriter->start(); // write at least the successfully serialized files
+        showStatusBarMessage(tr("Autosave failed: %1").arg(exc.getUserMsg()), 10000);
         return false;
     }
 }
@@ -247,6 +277,27 @@ bool ProjectEditor::closeAndDestroy(bool askForSave, QWidget* msgBoxParent) noex
     }
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void ProjectEditor::autosaveFinished(bool success, const QStringList& errors) noexcept
+{
+    if (success) {
+        qDebug() << "Project successfully autosaved";
+        showStatusBarMessage(tr("Project autosaved"), 5000);
+    } else {
+        qWarning() << "Autosave failed:" << errors;
+        showStatusBarMessage(tr("Autosave failed: %1").arg(errors.join(" ")), 10000);
+    }
+}
+
+void ProjectEditor::showStatusBarMessage(const QString& message, int timeout) noexcept
+{
+    mSchematicEditor->statusBar()->showMessage(message, timeout);
+    mBoardEditor->statusBar()->showMessage(message, timeout);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
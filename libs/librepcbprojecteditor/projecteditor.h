@@ -39,6 +39,7 @@ class QMainWindow;
 namespace librepcb {
 
 class UndoStack;
+class SmartXmlFileWriter;
 
 namespace workspace {
 class Workspace;
@@ -159,9 +160,12 @@ class ProjectEditor final : public QObject
         /**
          * @brief Make a automatic backup of the project (save to temporary files)
          *
+         * The project is only serialized in the GUI thread, the files are written in a
+         * worker thread. A following #saveProject() waits until they are written.
+         *
          * @note The whole save procedere is described in @ref doc_project_save.
          *
-         * @return true on success, false on failure
+         * @return true if the autosave was started, false if not (or on failure)
          */
         bool autosaveProject() noexcept;
 
@@ -203,6 +207,10 @@ class ProjectEditor final : public QObject
         ProjectEditor(const Project& other) = delete;
         ProjectEditor& operator=(const Project& rhs) = delete;
 
+        // Private Methods
+        void autosaveFinished(bool success, const QStringList& errors) noexcept;
+        void showStatusBarMessage(const QString& message, int timeout = 0) noexcept;
+
 
         // Attributes
         workspace::Workspace& mWorkspace;
@@ -210,6 +218,7 @@ class ProjectEditor final : public QObject
 
         // General
         QTimer mAutoSaveTimer; ///< the timer for the periodically automatic saving functionality (see also @ref doc_project_save)
+        SmartXmlFileWriter* mAutosaveWriter; ///< writes the autosaved files in a worker thread
         UndoStack* mUndoStack; ///< See @ref doc_project_undostack
         SchematicEditor* mSchematicEditor; ///< The schematic editor (GUI)
         BoardEditor* mBoardEditor; ///< The board editor (GUI)
@@ -31,6 +31,7 @@ SOURCES += \
     settings/items/wsi_base.cpp \
     settings/items/wsi_applocale.cpp \
     settings/items/wsi_projectautosaveinterval.cpp \
+    settings/items/wsi_projectundostacklimits.cpp \
     settings/items/wsi_librarylocaleorder.cpp \
     settings/items/wsi_appdefaultmeasurementunits.cpp \
     settings/items/wsi_librarynormorder.cpp \
@@ -48,6 +49,7 @@ HEADERS += \
     settings/items/wsi_base.h \
     settings/items/wsi_applocale.h \
     settings/items/wsi_projectautosaveinterval.h \
+    settings/items/wsi_projectundostacklimits.h \
     settings/items/wsi_librarylocaleorder.h \
     settings/items/wsi_appdefaultmeasurementunits.h \
     settings/items/wsi_librarynormorder.h \
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "wsi_appearance.h"
+#include <librepcbcommon/graphics/graphicsitem.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -35,7 +36,8 @@ namespace workspace {
  ****************************************************************************************/
 
 WSI_Appearance::WSI_Appearance(WorkspaceSettings& settings) :
-    WSI_Base(settings), mUseOpenGlWidget(nullptr), mUseOpenGlCheckBox(nullptr)
+    WSI_Base(settings), mUseOpenGlWidget(nullptr), mUseOpenGlCheckBox(nullptr),
+    mLodThresholdWidget(nullptr), mLodThresholdSpinBox(nullptr)
 {
     mUseOpenGlWidget = new QWidget();
     QGridLayout* openGlLayout = new QGridLayout(mUseOpenGlWidget);
@@ -45,12 +47,25 @@ WSI_Appearance::WSI_Appearance(WorkspaceSettings& settings) :
     openGlLayout->addWidget(new QLabel(tr("This setting will be applied only to newly "
                             "opened windows.")), openGlLayout->rowCount(), 0);
 
+    mLodThresholdWidget = new QWidget();
+    QHBoxLayout* lodLayout = new QHBoxLayout(mLodThresholdWidget);
+    lodLayout->setContentsMargins(0, 0, 0, 0);
+    lodLayout->addWidget(new QLabel(tr("Simplify objects smaller than")));
+    mLodThresholdSpinBox = new QSpinBox();
+    mLodThresholdSpinBox->setMinimum(0);
+    mLodThresholdSpinBox->setMaximum(100);
+    mLodThresholdSpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    lodLayout->addWidget(mLodThresholdSpinBox);
+    lodLayout->addWidget(new QLabel(tr("Pixels (0 = always draw all details)")));
+
     // load from settings
     revert();
+    applyLodThreshold();
 }
 
 WSI_Appearance::~WSI_Appearance()
 {
+    delete mLodThresholdWidget;     mLodThresholdWidget = nullptr;
     delete mUseOpenGlWidget;        mUseOpenGlWidget = nullptr;
 }
 
@@ -61,16 +76,42 @@ WSI_Appearance::~WSI_Appearance()
 void WSI_Appearance::restoreDefault()
 {
     mUseOpenGlCheckBox->setChecked(false);
+    mLodThresholdSpinBox->setValue(8);
 }
 
 void WSI_Appearance::apply()
 {
     saveValue("appearance_use_opengl", mUseOpenGlCheckBox->isChecked());
+    saveValue("appearance_lod_threshold", mLodThresholdSpinBox->value());
+    applyLodThreshold();
 }
 
 void WSI_Appearance::revert()
 {
     mUseOpenGlCheckBox->setChecked(loadValue("appearance_use_opengl", false).toBool());
+    mLodThresholdSpinBox->setValue(loadValue("appearance_lod_threshold", 8).toInt());
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void WSI_Appearance::applyLodThreshold() const noexcept
+{
+    // all thresholds are derived from the configured minimum text height
+    qreal threshold = mLodThresholdSpinBox->value();
+    GraphicsItem::LodThresholds_t thresholds;
+    thresholds.textHeight = threshold;
+    thresholds.padSize = threshold / 2;
+    thresholds.itemSize = threshold;
+    thresholds.lineWidth = threshold / 4;
+    GraphicsItem::setLodThresholds(thresholds);
+
+    // the thresholds are only evaluated while painting, so repaint all open views
+    foreach (QWidget* widget, QApplication::allWidgets()) {
+        QGraphicsView* view = qobject_cast<QGraphicsView*>(widget);
+        if (view) view->viewport()->update();
+    }
 }
 
 /*****************************************************************************************
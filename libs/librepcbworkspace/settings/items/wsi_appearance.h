@@ -53,10 +53,13 @@ class WSI_Appearance final : public WSI_Base
 
         // Getters
         bool getUseOpenGl() const noexcept {return mUseOpenGlCheckBox->isChecked();}
+        int getLodThreshold() const noexcept {return mLodThresholdSpinBox->value();}
 
         // Getters: Widgets
         QString getUseOpenGlLabelText() const {return tr("Rendering Method:");}
         QWidget* getUseOpenGlWidget() const {return mUseOpenGlWidget;}
+        QString getLodThresholdLabelText() const {return tr("Level of Detail:");}
+        QWidget* getLodThresholdWidget() const {return mLodThresholdWidget;}
 
         // General Methods
         void restoreDefault();
@@ -70,10 +73,15 @@ class WSI_Appearance final : public WSI_Base
         WSI_Appearance(const WSI_Appearance& other);
         WSI_Appearance& operator=(const WSI_Appearance& rhs);
 
+        // Private Methods
+        void applyLodThreshold() const noexcept;
+
 
         // Widgets
         QWidget* mUseOpenGlWidget;
         QCheckBox* mUseOpenGlCheckBox;
+        QWidget* mLodThresholdWidget;
+        QSpinBox* mLodThresholdSpinBox;
 };
 
 /*****************************************************************************************
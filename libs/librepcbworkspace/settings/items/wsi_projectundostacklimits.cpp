@@ -0,0 +1,130 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "wsi_projectundostacklimits.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+WSI_ProjectUndoStackLimits::WSI_ProjectUndoStackLimits(WorkspaceSettings& settings) :
+    WSI_Base(settings), mWidget(0), mCountSpinBox(0), mMemorySpinBox(0)
+{
+    bool ok;
+    mMaxCount = loadValue("project_undo_stack_max_count", 500).toInt(&ok);
+    if ((!ok) || (mMaxCount < 0)) mMaxCount = 500;
+    mMaxCountTmp = mMaxCount;
+    mMaxMemoryMb = loadValue("project_undo_stack_max_memory_mb", 100).toInt(&ok);
+    if ((!ok) || (mMaxMemoryMb < 0)) mMaxMemoryMb = 100;
+    mMaxMemoryMbTmp = mMaxMemoryMb;
+
+    mCountSpinBox = new QSpinBox();
+    mCountSpinBox->setMinimum(0);
+    mCountSpinBox->setMaximum(100000);
+    mCountSpinBox->setValue(mMaxCount);
+    mCountSpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    connect(mCountSpinBox, SIGNAL(valueChanged(int)), this, SLOT(countSpinBoxValueChanged(int)));
+
+    mMemorySpinBox = new QSpinBox();
+    mMemorySpinBox->setMinimum(0);
+    mMemorySpinBox->setMaximum(10000);
+    mMemorySpinBox->setValue(mMaxMemoryMb);
+    mMemorySpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    connect(mMemorySpinBox, SIGNAL(valueChanged(int)), this, SLOT(memorySpinBoxValueChanged(int)));
+
+    // create a QWidget
+    mWidget = new QWidget();
+    QHBoxLayout* layout = new QHBoxLayout(mWidget);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(mCountSpinBox);
+    layout->addWidget(new QLabel(tr("Commands")));
+    layout->addWidget(mMemorySpinBox);
+    layout->addWidget(new QLabel(tr("MB (0 = unlimited)")));
+}
+
+WSI_ProjectUndoStackLimits::~WSI_ProjectUndoStackLimits()
+{
+    delete mMemorySpinBox;      mMemorySpinBox = 0;
+    delete mCountSpinBox;       mCountSpinBox = 0;
+    delete mWidget;             mWidget = 0;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WSI_ProjectUndoStackLimits::restoreDefault()
+{
+    mMaxCountTmp = 500;
+    mMaxMemoryMbTmp = 100;
+    mCountSpinBox->setValue(mMaxCountTmp);
+    mMemorySpinBox->setValue(mMaxMemoryMbTmp);
+}
+
+void WSI_ProjectUndoStackLimits::apply()
+{
+    if (mMaxCount != mMaxCountTmp) {
+        mMaxCount = mMaxCountTmp;
+        saveValue("project_undo_stack_max_count", mMaxCount);
+    }
+    if (mMaxMemoryMb != mMaxMemoryMbTmp) {
+        mMaxMemoryMb = mMaxMemoryMbTmp;
+        saveValue("project_undo_stack_max_memory_mb", mMaxMemoryMb);
+    }
+}
+
+void WSI_ProjectUndoStackLimits::revert()
+{
+    mMaxCountTmp = mMaxCount;
+    mMaxMemoryMbTmp = mMaxMemoryMb;
+    mCountSpinBox->setValue(mMaxCountTmp);
+    mMemorySpinBox->setValue(mMaxMemoryMbTmp);
+}
+
+/*****************************************************************************************
+ *  Public Slots
+ ****************************************************************************************/
+
+void WSI_ProjectUndoStackLimits::countSpinBoxValueChanged(int value)
+{
+    mMaxCountTmp = value;
+}
+
+void WSI_ProjectUndoStackLimits::memorySpinBoxValueChanged(int value)
+{
+    mMaxMemoryMbTmp = value;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
@@ -0,0 +1,114 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WSI_PROJECTUNDOSTACKLIMITS_H
+#define LIBREPCB_WSI_PROJECTUNDOSTACKLIMITS_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include "wsi_base.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class WSI_ProjectUndoStackLimits
+ ****************************************************************************************/
+
+/**
+ * @brief The WSI_ProjectUndoStackLimits class represents the limits of the project's
+ *        undo stack
+ *
+ * This setting is used by the class #project#ProjectEditor to limit the count and the
+ * memory usage of the commands in its undo stack (see UndoStack#setLimits()). A value
+ * of zero means that there is no limit.
+ */
+class WSI_ProjectUndoStackLimits final : public WSI_Base
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        explicit WSI_ProjectUndoStackLimits(WorkspaceSettings& settings);
+        ~WSI_ProjectUndoStackLimits();
+
+        // Getters
+        int getMaxCommandCount() const {return mMaxCount;}
+        qint64 getMaxMemorySize() const {return qint64(mMaxMemoryMb) * 1024 * 1024;}
+
+        // Getters: Widgets
+        QString getLabelText() const {return tr("Project Undo Limits:");}
+        QWidget* getWidget() const {return mWidget;}
+
+        // General Methods
+        void restoreDefault();
+        void apply();
+        void revert();
+
+    public slots:
+
+        // Public Slots
+        void countSpinBoxValueChanged(int value);
+        void memorySpinBoxValueChanged(int value);
+
+    private:
+
+        // make some methods inaccessible...
+        WSI_ProjectUndoStackLimits();
+        WSI_ProjectUndoStackLimits(const WSI_ProjectUndoStackLimits& other);
+        WSI_ProjectUndoStackLimits& operator=(const WSI_ProjectUndoStackLimits& rhs);
+
+
+        // General Attributes
+
+        /**
+         * @brief the maximum count of undo commands (0 = unlimited)
+         *
+         * Default: 500 commands
+         */
+        int mMaxCount;
+        int mMaxCountTmp;
+
+        /**
+         * @brief the maximum memory usage of all undo commands [MB] (0 = unlimited)
+         *
+         * Default: 100 MB
+         */
+        int mMaxMemoryMb;
+        int mMaxMemoryMbTmp;
+
+        // Widgets
+        QWidget* mWidget;
+        QSpinBox* mCountSpinBox;
+        QSpinBox* mMemorySpinBox;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WSI_PROJECTUNDOSTACKLIMITS_H
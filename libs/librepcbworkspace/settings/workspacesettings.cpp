@@ -38,8 +38,8 @@ namespace workspace {
 
 WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
     QObject(0), mMetadataPath(workspace.getMetadataPath()), mDialog(0),
-    mAppLocale(0), mProjectAutosaveInterval(0), mLibraryLocaleOrder(0),
-    mLibraryNormOrder(0), mDebugTools(0), mAppearance(0)
+    mAppLocale(0), mProjectAutosaveInterval(0), mProjectUndoStackLimits(0),
+    mLibraryLocaleOrder(0), mLibraryNormOrder(0), mDebugTools(0), mAppearance(0)
 {
     // check if the metadata directory exists
     if (!mMetadataPath.isExistingDir())
@@ -61,6 +61,7 @@ WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
     mItems.append(mAppLocale                = new WSI_AppLocale(*this));
     mItems.append(mAppDefMeasUnits          = new WSI_AppDefaultMeasurementUnits(*this));
     mItems.append(mProjectAutosaveInterval  = new WSI_ProjectAutosaveInterval(*this));
+    mItems.append(mProjectUndoStackLimits   = new WSI_ProjectUndoStackLimits(*this));
     mItems.append(mLibraryLocaleOrder       = new WSI_LibraryLocaleOrder(*this));
     mItems.append(mLibraryNormOrder         = new WSI_LibraryNormOrder(*this));
     mItems.append(mDebugTools               = new WSI_DebugTools(*this));
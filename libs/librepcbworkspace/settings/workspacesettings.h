@@ -30,6 +30,7 @@
 #include "items/wsi_applocale.h"
 #include "items/wsi_appdefaultmeasurementunits.h"
 #include "items/wsi_projectautosaveinterval.h"
+#include "items/wsi_projectundostacklimits.h"
 #include "items/wsi_librarylocaleorder.h"
 #include "items/wsi_librarynormorder.h"
 #include "items/wsi_debugtools.h"
@@ -93,6 +94,7 @@ class WorkspaceSettings final : public QObject
         WSI_AppLocale* getAppLocale() const noexcept {return mAppLocale;}
         WSI_AppDefaultMeasurementUnits* getAppDefMeasUnits() const noexcept {return mAppDefMeasUnits;}
         WSI_ProjectAutosaveInterval* getProjectAutosaveInterval() const noexcept {return mProjectAutosaveInterval;}
+        WSI_ProjectUndoStackLimits* getProjectUndoStackLimits() const noexcept {return mProjectUndoStackLimits;}
         WSI_LibraryLocaleOrder* getLibLocaleOrder() const noexcept {return mLibraryLocaleOrder;}
         WSI_LibraryNormOrder* getLibNormOrder() const noexcept {return mLibraryNormOrder;}
         WSI_DebugTools* getDebugTools() const noexcept {return mDebugTools;}
@@ -133,6 +135,7 @@ class WorkspaceSettings final : public QObject
         WSI_AppLocale* mAppLocale;
         WSI_AppDefaultMeasurementUnits* mAppDefMeasUnits;
         WSI_ProjectAutosaveInterval* mProjectAutosaveInterval;
+        WSI_ProjectUndoStackLimits* mProjectUndoStackLimits;
         WSI_LibraryLocaleOrder* mLibraryLocaleOrder;
         WSI_LibraryNormOrder* mLibraryNormOrder;
         WSI_DebugTools* mDebugTools;
@@ -51,10 +51,14 @@ WorkspaceSettingsDialog::WorkspaceSettingsDialog(WorkspaceSettings& settings) :
                                mSettings.getAppDefMeasUnits()->getLengthUnitComboBox());
     mUi->generalLayout->addRow(mSettings.getProjectAutosaveInterval()->getLabelText(),
                                mSettings.getProjectAutosaveInterval()->getWidget());
+    mUi->generalLayout->addRow(mSettings.getProjectUndoStackLimits()->getLabelText(),
+                               mSettings.getProjectUndoStackLimits()->getWidget());
 
     // tab: appearance
     mUi->appearanceLayout->addRow(mSettings.getAppearance()->getUseOpenGlLabelText(),
                                  mSettings.getAppearance()->getUseOpenGlWidget());
+    mUi->appearanceLayout->addRow(mSettings.getAppearance()->getLodThresholdLabelText(),
+                                 mSettings.getAppearance()->getLodThresholdWidget());
 
     // tab: library
     mUi->libraryLayout->addRow(mSettings.getLibLocaleOrder()->getLabelText(),
@@ -82,9 +86,11 @@ WorkspaceSettingsDialog::~WorkspaceSettingsDialog()
     mSettings.getAppLocale()->getWidget()->setParent(0);
     mSettings.getAppDefMeasUnits()->getLengthUnitComboBox()->setParent(0);
     mSettings.getProjectAutosaveInterval()->getWidget()->setParent(0);
+    mSettings.getProjectUndoStackLimits()->getWidget()->setParent(0);
 
     // tab: appearance
     mSettings.getAppearance()->getUseOpenGlWidget()->setParent(0);
+    mSettings.getAppearance()->getLodThresholdWidget()->setParent(0);
 
     // tab: library
     mSettings.getLibLocaleOrder()->getWidget()->setParent(0);
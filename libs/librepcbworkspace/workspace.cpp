@@ -26,6 +26,7 @@
 #include <librepcbcommon/exceptions.h>
 #include <librepcbcommon/fileio/filepath.h>
 #include <librepcblibrary/library.h>
+#include <librepcblibrary/previewthumbnailcache.h>
 #include <librepcblibraryeditor/libraryeditor.h>
 #include <librepcbproject/project.h>
 #include "projecttreemodel.h"
@@ -54,8 +55,8 @@ Workspace::Workspace(const FilePath& wsPath) throw (Exception) :
     mMetadataPath(wsPath.getPathTo(QString(".metadata/v%1").arg(APP_VERSION_MAJOR))),
     mProjectsPath(wsPath.getPathTo("projects")),
     mLibraryPath(wsPath.getPathTo("library")),
-    mWorkspaceSettings(0), mLibrary(0), mProjectTreeModel(0), mRecentProjectsModel(0),
-    mFavoriteProjectsModel(0)
+    mWorkspaceSettings(0), mLibrary(0), mPreviewThumbnailCache(0), mProjectTreeModel(0),
+    mRecentProjectsModel(0), mFavoriteProjectsModel(0)
 {
     try
     {
@@ -104,10 +105,14 @@ Workspace::Workspace(const FilePath& wsPath) throw (Exception) :
         mFavoriteProjectsModel = new FavoriteProjectsModel(*this);
         mProjectTreeModel = new ProjectTreeModel(*this);
         mLibrary = new Library(mLibraryPath, mMetadataPath.getPathTo("library_cache.sqlite"));
+        mPreviewThumbnailCache = new PreviewThumbnailCache(*mLibrary, mMetadataPath.getPathTo("thumbnails"));
+        connect(mLibrary, &Library::elementsModified,
+                mPreviewThumbnailCache, &PreviewThumbnailCache::clear, Qt::QueuedConnection);
     }
     catch (Exception& e)
     {
         // free allocated memory and rethrow the exception
+        delete mPreviewThumbnailCache;  mPreviewThumbnailCache = 0;
         delete mLibrary;                mLibrary = 0;
         delete mProjectTreeModel;       mProjectTreeModel = 0;
         delete mFavoriteProjectsModel;  mFavoriteProjectsModel = 0;
@@ -119,6 +124,7 @@ Workspace::Workspace(const FilePath& wsPath) throw (Exception) :
 
 Workspace::~Workspace()
 {
+    delete mPreviewThumbnailCache;  mPreviewThumbnailCache = 0;
     delete mLibrary;                mLibrary = 0;
     delete mProjectTreeModel;       mProjectTreeModel = 0;
     delete mFavoriteProjectsModel;  mFavoriteProjectsModel = 0;
@@ -34,6 +34,7 @@ namespace librepcb {
 
 namespace library{
 class Library;
+class PreviewThumbnailCache;
 }
 
 namespace project{
@@ -120,6 +121,11 @@ class Workspace final : public QObject
          */
         library::Library& getLibrary() const {return *mLibrary;}
 
+        /**
+         * @brief Get the cache of the library element preview thumbnails
+         */
+        library::PreviewThumbnailCache& getPreviewThumbnailCache() const {return *mPreviewThumbnailCache;}
+
 
         // Project Management
 
@@ -211,6 +217,7 @@ class Workspace final : public QObject
         FilePath mLibraryPath; ///< the directory "library"
         WorkspaceSettings* mWorkspaceSettings; ///< the WorkspaceSettings object
         library::Library* mLibrary; ///< the library of the workspace
+        library::PreviewThumbnailCache* mPreviewThumbnailCache; ///< thumbnails of library elements
         ProjectTreeModel* mProjectTreeModel; ///< a tree model for the whole projects directory
         RecentProjectsModel* mRecentProjectsModel; ///< a list model of all recent projects
         FavoriteProjectsModel* mFavoriteProjectsModel; ///< a list model of all favorite projects
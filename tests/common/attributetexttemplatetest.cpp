@@ -0,0 +1,142 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcbcommon/if_attributeprovider.h>
+#include <librepcbcommon/attributetexttemplate.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class AttributeTextTemplateTest : public ::testing::Test, public IF_AttributeProvider
+{
+    public:
+        bool getAttributeValue(const QString& attrNS, const QString& attrKey,
+                               bool passToParents, QString& value) const noexcept override
+        {
+            Q_UNUSED(passToParents);
+            QString key = attrNS.isEmpty() ? attrKey : (attrNS % "::" % attrKey);
+            if (!mAttributes.contains(key)) return false;
+            value = mAttributes.value(key);
+            return true;
+        }
+
+        void attributesChanged(const QString& key = QString()) override {Q_UNUSED(key);}
+
+    protected:
+        QHash<QString, QString> mAttributes;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(AttributeTextTemplateTest, testTextWithoutVariables)
+{
+    AttributeTextTemplate tpl("hello world");
+    EXPECT_FALSE(tpl.hasVariables());
+    EXPECT_TRUE(tpl.update(*this, false));
+    EXPECT_EQ(QString("hello world"), tpl.getText());
+    EXPECT_FALSE(tpl.update(*this, false));
+}
+
+TEST_F(AttributeTextTemplateTest, testSameResultAsReplaceVariables)
+{
+    mAttributes.insert("CMP::NAME", "U1");
+    mAttributes.insert("VALUE", "${CMP::NAME}-10k");
+    mAttributes.insert("SELF", "a${SELF}b");
+    QStringList texts;
+    texts << "" << "${CMP::NAME}" << "x${CMP::NAME}y${VALUE}z${CMP::NAME}"
+          << "${UNKNOWN}!" << "${SELF}" << "${unterminated" << "${}";
+    foreach (const QString& text, texts) {
+        QString expected = text;
+        replaceVariablesWithAttributes(expected, false);
+        AttributeTextTemplate tpl(text);
+        tpl.update(*this, false);
+        EXPECT_EQ(expected, tpl.getText()) << qPrintable(text);
+    }
+}
+
+TEST_F(AttributeTextTemplateTest, testDependencies)
+{
+    AttributeTextTemplate tpl("${CMP::NAME} ${VALUE} ${CMP::NAME}");
+    EXPECT_EQ(QStringList() << "CMP::NAME" << "VALUE", tpl.getDependencies());
+}
+
+TEST_F(AttributeTextTemplateTest, testUpdateOnlyIfDependencyChanged)
+{
+    mAttributes.insert("CMP::NAME", "U1");
+    mAttributes.insert("OTHER", "foo");
+    AttributeTextTemplate tpl("${CMP::NAME}");
+    EXPECT_TRUE(tpl.update(*this, false));
+
+    mAttributes.insert("OTHER", "bar");
+    EXPECT_FALSE(tpl.update(*this, false));
+
+    mAttributes.insert("CMP::NAME", "U2");
+    EXPECT_TRUE(tpl.update(*this, false));
+    EXPECT_EQ(QString("U2"), tpl.getText());
+}
+
+TEST_F(AttributeTextTemplateTest, testDependsOnAttribute)
+{
+    mAttributes.insert("CMP::NAME", "U1");
+    AttributeTextTemplate tpl("${CMP::NAME}");
+    EXPECT_TRUE(tpl.dependsOnAttribute("OTHER")); // not evaluated yet
+    tpl.update(*this, false);
+    EXPECT_TRUE(tpl.dependsOnAttribute("NAME"));
+    EXPECT_TRUE(tpl.dependsOnAttribute(QString())); // unknown attribute
+    EXPECT_FALSE(tpl.dependsOnAttribute("OTHER"));
+
+    AttributeTextTemplate constant("hello world");
+    constant.update(*this, false);
+    EXPECT_FALSE(constant.dependsOnAttribute(QString()));
+}
+
+TEST_F(AttributeTextTemplateTest, testDependsOnNestedAttribute)
+{
+    mAttributes.insert("VALUE", "${OTHER}");
+    mAttributes.insert("OTHER", "foo");
+    AttributeTextTemplate tpl("${VALUE}");
+    tpl.update(*this, false);
+    EXPECT_EQ(QString("foo"), tpl.getText());
+    EXPECT_TRUE(tpl.dependsOnAttribute("OTHER"));
+
+    mAttributes.insert("OTHER", "bar");
+    EXPECT_TRUE(tpl.update(*this, false));
+    EXPECT_EQ(QString("bar"), tpl.getText());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
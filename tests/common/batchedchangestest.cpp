@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcbcommon/batchedchanges.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class BatchedChangesTest : public ::testing::Test
+{
+    protected:
+        void takeAll(BatchedChanges<int>& changes)
+        {
+            QList<int> added, removed, changed;
+            changes.takeAll(added, removed, changed);
+            mAdded = added.toSet();
+            mRemoved = removed.toSet();
+            mChanged = changed.toSet();
+        }
+
+        QSet<int> mAdded;
+        QSet<int> mRemoved;
+        QSet<int> mChanged;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BatchedChangesTest, testEmpty)
+{
+    BatchedChanges<int> changes;
+    EXPECT_TRUE(changes.isEmpty());
+    takeAll(changes);
+    EXPECT_TRUE(mAdded.isEmpty());
+    EXPECT_TRUE(mRemoved.isEmpty());
+    EXPECT_TRUE(mChanged.isEmpty());
+}
+
+TEST_F(BatchedChangesTest, testAddRemoveUpdate)
+{
+    BatchedChanges<int> changes;
+    changes.add(1);
+    changes.remove(2);
+    changes.update(3);
+    EXPECT_FALSE(changes.isEmpty());
+    takeAll(changes);
+    EXPECT_EQ(QSet<int>({1}), mAdded);
+    EXPECT_EQ(QSet<int>({2}), mRemoved);
+    EXPECT_EQ(QSet<int>({3}), mChanged);
+    EXPECT_TRUE(changes.isEmpty()); // takeAll() resets the changes
+}
+
+TEST_F(BatchedChangesTest, testAddAndRemoveCancelOut)
+{
+    BatchedChanges<int> changes;
+    changes.add(1);
+    changes.update(1);
+    changes.remove(1);
+    EXPECT_TRUE(changes.isEmpty());
+}
+
+TEST_F(BatchedChangesTest, testRemoveAndAddIsChange)
+{
+    BatchedChanges<int> changes;
+    changes.remove(1);
+    changes.add(1);
+    takeAll(changes);
+    EXPECT_TRUE(mAdded.isEmpty());
+    EXPECT_TRUE(mRemoved.isEmpty());
+    EXPECT_EQ(QSet<int>({1}), mChanged);
+}
+
+TEST_F(BatchedChangesTest, testUpdateAndRemoveIsRemove)
+{
+    BatchedChanges<int> changes;
+    changes.update(1);
+    changes.remove(1);
+    takeAll(changes);
+    EXPECT_TRUE(mAdded.isEmpty());
+    EXPECT_EQ(QSet<int>({1}), mRemoved);
+    EXPECT_TRUE(mChanged.isEmpty());
+}
+
+TEST_F(BatchedChangesTest, testAddAndUpdateIsAdd)
+{
+    BatchedChanges<int> changes;
+    changes.add(1);
+    changes.update(1);
+    takeAll(changes);
+    EXPECT_EQ(QSet<int>({1}), mAdded);
+    EXPECT_TRUE(mRemoved.isEmpty());
+    EXPECT_TRUE(mChanged.isEmpty());
+}
+
+TEST_F(BatchedChangesTest, testRemoveAddRemove)
+{
+    BatchedChanges<int> changes;
+    changes.remove(1);
+    changes.add(1);
+    changes.remove(1);
+    takeAll(changes);
+    EXPECT_TRUE(mAdded.isEmpty());
+    EXPECT_EQ(QSet<int>({1}), mRemoved);
+    EXPECT_TRUE(mChanged.isEmpty());
+}
+
+TEST_F(BatchedChangesTest, testClear)
+{
+    BatchedChanges<int> changes;
+    changes.add(1);
+    changes.remove(2);
+    changes.clear();
+    EXPECT_TRUE(changes.isEmpty());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
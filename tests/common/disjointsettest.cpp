@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcbcommon/disjointset.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class DisjointSetTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(DisjointSetTest, testAdd)
+{
+    DisjointSet<int> set;
+    set.add(1);
+    set.add(2);
+    set.add(1);
+    EXPECT_EQ(2, set.getElementCount());
+    EXPECT_EQ(2, set.getSetCount());
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_FALSE(set.areInSameSet(1, 2));
+}
+
+TEST(DisjointSetTest, testUnite)
+{
+    DisjointSet<int> set;
+    EXPECT_TRUE(set.unite(1, 2));
+    EXPECT_TRUE(set.unite(3, 4));
+    EXPECT_FALSE(set.unite(2, 1));
+    EXPECT_EQ(2, set.getSetCount());
+    EXPECT_TRUE(set.areInSameSet(1, 2));
+    EXPECT_FALSE(set.areInSameSet(1, 3));
+    EXPECT_TRUE(set.unite(2, 4));
+    EXPECT_EQ(1, set.getSetCount());
+    EXPECT_TRUE(set.areInSameSet(1, 3));
+    EXPECT_EQ(set.find(1), set.find(4));
+}
+
+TEST(DisjointSetTest, testLongChain)
+{
+    DisjointSet<int> set;
+    for (int i = 1; i < 10000; ++i) {
+        set.unite(i - 1, i);
+    }
+    EXPECT_EQ(10000, set.getElementCount());
+    EXPECT_EQ(1, set.getSetCount());
+    EXPECT_TRUE(set.areInSameSet(0, 9999));
+}
+
+TEST(DisjointSetTest, testClear)
+{
+    DisjointSet<int> set;
+    set.unite(1, 2);
+    set.clear();
+    EXPECT_EQ(0, set.getElementCount());
+    EXPECT_EQ(0, set.getSetCount());
+    EXPECT_FALSE(set.areInSameSet(1, 2));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
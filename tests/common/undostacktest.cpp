@@ -0,0 +1,226 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcbcommon/undostack.h>
+#include <librepcbcommon/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief A command which does nothing, but has a fixed size and counts its destructions
+ *        (and optionally throws an exception when it is undone)
+ */
+class UndoStackTestCommand final : public UndoCommand
+{
+    public:
+        UndoStackTestCommand(qint64 size, int& deletedCount, bool throwOnUndo = false) noexcept :
+            UndoCommand("test"), mSize(size), mDeletedCount(deletedCount),
+            mThrowOnUndo(throwOnUndo) {}
+        ~UndoStackTestCommand() noexcept {mDeletedCount++;}
+        qint64 getEstimatedMemorySize() const noexcept override {return mSize;}
+    private:
+        bool performExecute() throw (Exception) override {return true;}
+        void performUndo() throw (Exception) override
+        {
+            if (mThrowOnUndo) throw RuntimeError(__FILE__, __LINE__);
+        }
+        void performRedo() throw (Exception) override {}
+        qint64 mSize;
+        int& mDeletedCount;
+        bool mThrowOnUndo;
+};
+
+class UndoStackTest : public ::testing::Test
+{
+    protected:
+        void execCommands(UndoStack& stack, int count, qint64 size = 100)
+        {
+            for (int i = 0; i < count; ++i) {
+                stack.execCmd(new UndoStackTestCommand(size, mDeletedCount));
+            }
+        }
+
+        int countUndoableCommands(UndoStack& stack)
+        {
+            int count = 0;
+            while (stack.canUndo()) {
+                stack.undo();
+                count++;
+            }
+            return count;
+        }
+
+        int mDeletedCount = 0;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(UndoStackTest, testUnlimited)
+{
+    UndoStack stack;
+    execCommands(stack, 100);
+    EXPECT_EQ(0, mDeletedCount);
+    EXPECT_EQ(100, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testTrimByCount)
+{
+    UndoStack stack;
+    stack.setLimits(3, 0);
+    execCommands(stack, 5);
+    EXPECT_EQ(2, mDeletedCount);
+    EXPECT_EQ(3, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testTrimBySize)
+{
+    UndoStack stack;
+    stack.setLimits(0, 2500);
+    execCommands(stack, 5, 1000);
+    EXPECT_EQ(3, mDeletedCount);
+    EXPECT_EQ(2, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testSetLimitsTrimsExistingCommands)
+{
+    UndoStack stack;
+    execCommands(stack, 5);
+    stack.setLimits(1, 0);
+    EXPECT_EQ(4, mDeletedCount);
+    EXPECT_EQ(1, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testTopCommandIsNeverTrimmed)
+{
+    UndoStack stack;
+    stack.setLimits(0, 10);
+    execCommands(stack, 2, 1000);
+    EXPECT_EQ(1, mDeletedCount);
+    EXPECT_EQ(1, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testRedoableCommandsAreNeverTrimmed)
+{
+    UndoStack stack;
+    execCommands(stack, 5);
+    stack.undo();
+    stack.undo();
+    stack.undo();
+    stack.setLimits(1, 0);
+    EXPECT_EQ(1, mDeletedCount);
+    EXPECT_EQ(1, countUndoableCommands(stack));
+    int redoCount = 0;
+    while (stack.canRedo()) {
+        stack.redo();
+        redoCount++;
+    }
+    EXPECT_EQ(4, redoCount);
+}
+
+TEST_F(UndoStackTest, testCleanIndexIsShifted)
+{
+    UndoStack stack;
+    execCommands(stack, 3);
+    stack.setClean();
+    execCommands(stack, 2);
+    stack.setLimits(2, 0);
+    EXPECT_EQ(3, mDeletedCount);
+    EXPECT_FALSE(stack.isClean());
+    stack.undo();
+    EXPECT_FALSE(stack.isClean());
+    stack.undo();
+    EXPECT_TRUE(stack.isClean()); // the clean state is still reachable
+    EXPECT_FALSE(stack.canUndo());
+    stack.redo();
+    EXPECT_FALSE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testCleanIndexIsTrimmed)
+{
+    UndoStack stack;
+    execCommands(stack, 1);
+    stack.setClean();
+    execCommands(stack, 4);
+    stack.setLimits(2, 0);
+    EXPECT_EQ(3, mDeletedCount);
+    EXPECT_FALSE(stack.isClean());
+    EXPECT_EQ(2, countUndoableCommands(stack));
+    EXPECT_FALSE(stack.isClean()); // the clean state is no longer reachable
+}
+
+TEST_F(UndoStackTest, testInitialCleanIndexIsTrimmed)
+{
+    UndoStack stack;
+    stack.setLimits(1, 0);
+    execCommands(stack, 3);
+    EXPECT_EQ(2, mDeletedCount);
+    EXPECT_EQ(1, countUndoableCommands(stack));
+    EXPECT_FALSE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testCommandGroupIsTrimmedAfterCommit)
+{
+    UndoStack stack;
+    stack.setLimits(0, 2500);
+    execCommands(stack, 2, 1000);
+    stack.beginCmdGroup("group");
+    stack.appendToCmdGroup(new UndoStackTestCommand(1000, mDeletedCount));
+    stack.appendToCmdGroup(new UndoStackTestCommand(1000, mDeletedCount));
+    EXPECT_EQ(0, mDeletedCount); // nothing is trimmed while the group is active
+    stack.commitCmdGroup();
+    EXPECT_EQ(2, mDeletedCount); // the grown group no longer fits with the older commands
+    EXPECT_EQ(1, countUndoableCommands(stack));
+}
+
+TEST_F(UndoStackTest, testAbortCmdGroupFinishesTransactionOnError)
+{
+    UndoStack stack;
+    int openTransactions = 0;
+    QObject::connect(&stack, &UndoStack::transactionStarted, [&](){openTransactions++;});
+    QObject::connect(&stack, &UndoStack::transactionFinished, [&](){openTransactions--;});
+    stack.beginCmdGroup("group");
+    stack.appendToCmdGroup(new UndoStackTestCommand(100, mDeletedCount, true));
+    EXPECT_EQ(1, openTransactions);
+    EXPECT_THROW(stack.abortCmdGroup(), Exception);
+    EXPECT_EQ(0, openTransactions);
+    EXPECT_FALSE(stack.isCommandGroupActive());
+    EXPECT_EQ(1, mDeletedCount); // the aborted group is removed from the stack anyway
+    EXPECT_EQ(0, countUndoableCommands(stack));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,128 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 Urban Bruhin
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcbcommon/uuid.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Data Type
+ ****************************************************************************************/
+
+typedef struct {
+    bool valid;
+    QString uuid;
+} UuidTestData_t;
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class UuidTest : public ::testing::TestWithParam<UuidTestData_t>
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_P(UuidTest, testDefaultConstructor)
+{
+    Uuid uuid;
+    EXPECT_TRUE(uuid.isNull());
+    EXPECT_TRUE(uuid.toStr().isEmpty());
+}
+
+TEST_P(UuidTest, testCreateRandom)
+{
+    Uuid uuid1 = Uuid::createRandom();
+    Uuid uuid2 = Uuid::createRandom();
+    EXPECT_FALSE(uuid1.isNull());
+    EXPECT_TRUE(uuid1 != uuid2);
+    EXPECT_EQ(uuid1, Uuid(uuid1.toStr()));
+}
+
+TEST_P(UuidTest, testSetUuid)
+{
+    const UuidTestData_t& data = GetParam();
+
+    Uuid uuid;
+    EXPECT_EQ(data.valid, uuid.setUuid(data.uuid));
+    EXPECT_EQ(!data.valid, uuid.isNull());
+    if (data.valid) {
+        EXPECT_EQ(data.uuid.toLower(), uuid.toStr());
+    }
+}
+
+TEST_P(UuidTest, testCompareAndHash)
+{
+    const UuidTestData_t& data = GetParam();
+
+    Uuid uuid(data.uuid);
+    Uuid other("d79d354b-62bd-4866-b8d9-8b0a4a7ba1d5");
+    if (data.valid) {
+        EXPECT_TRUE(uuid == Uuid(data.uuid.toLower()));
+        EXPECT_EQ(qHash(uuid, 0), qHash(Uuid(data.uuid.toLower()), 0));
+        // the order must be the same as the order of the (lowercase) strings
+        EXPECT_EQ(data.uuid.toLower() < other.toStr(), uuid < other);
+        EXPECT_EQ(data.uuid.toLower() > other.toStr(), uuid > other);
+    } else {
+        // comparing with a NULL UUID is always false
+        EXPECT_FALSE(uuid == other);
+        EXPECT_FALSE(uuid != other);
+        EXPECT_FALSE(uuid < other);
+    }
+}
+
+/*****************************************************************************************
+ *  Test Data
+ ****************************************************************************************/
+
+INSTANTIATE_TEST_CASE_P(UuidTest, UuidTest, ::testing::Values(
+    //             {valid, uuid}
+    UuidTestData_t({true,  "d79d354b-62bd-4866-b8d9-8b0a4a7ba1d5"}),
+    UuidTestData_t({true,  "00000000-0000-4000-8000-000000000000"}),
+    UuidTestData_t({true,  "ffffffff-ffff-4fff-bfff-ffffffffffff"}),
+    UuidTestData_t({true,  "D79D354B-62BD-4866-B8D9-8B0A4A7BA1D6"}),
+    UuidTestData_t({false, ""}),
+    UuidTestData_t({false, "00000000-0000-0000-0000-000000000000"}),
+    UuidTestData_t({false, "{d79d354b-62bd-4866-b8d9-8b0a4a7ba1d5}"}),
+    UuidTestData_t({false, "d79d354b-62bd-4866-b8d9-8b0a4a7ba1d"}),
+    UuidTestData_t({false, "d79d354b-62bd-1866-b8d9-8b0a4a7ba1d5"}),     // version 1
+    UuidTestData_t({false, "d79d354b-62bd-4866-78d9-8b0a4a7ba1d5"}),     // wrong variant
+    UuidTestData_t({false, "d79d354b_62bd-4866-b8d9-8b0a4a7ba1d5"}),
+    UuidTestData_t({false, "x79d354b-62bd-4866-b8d9-8b0a4a7ba1d5"})
+));
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,237 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <QtXml>
+#include <librepcbcommon/fileio/xmldomdocument.h>
+#include <librepcbcommon/fileio/xmldomelement.h>
+#include <librepcbcommon/fileio/filepath.h>
+#include <librepcbcommon/exceptions.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class XmlDomElementTest : public ::testing::Test
+{
+    protected:
+
+        // Texts which contain all characters which need to be escaped somehow
+        static QStringList getSpecialStrings() noexcept
+        {
+            return QStringList() << "foo" << "<tag>" << "a & b" << "\"quoted\"" << "it's"
+                                 << "]]>" << "line1\nline2" << "cr\r\nlf" << "tab\there"
+                                 << " leading and trailing "
+                                 << QString::fromUtf8("\xc3\xa4\xe2\x82\xac");
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(XmlDomElementTest, testOutputIsIdenticalToQDom)
+{
+    XmlDomElement* root = new XmlDomElement("root");
+    QDomDocument domDoc;
+    domDoc.setContent(QString("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>"));
+    QDomElement domRoot = domDoc.createElement("root");
+    domDoc.appendChild(domRoot);
+
+    foreach (const QString& value, getSpecialStrings()) {
+
+        // element with text
+        root->appendTextChild("text", value);
+        QDomElement domText = domDoc.createElement("text");
+        domText.appendChild(domDoc.createTextNode(value));
+        domRoot.appendChild(domText);
+
+        // element with an attribute (only one, QDom does not sort the attributes)
+        XmlDomElement* attr = root->appendChild("attr");
+        attr->setAttribute("value", value);
+        QDomElement domAttr = domDoc.createElement("attr");
+        domAttr.setAttribute("value", value);
+        domRoot.appendChild(domAttr);
+    }
+
+    // empty element and nested elements
+    root->appendChild("empty");
+    domRoot.appendChild(domDoc.createElement("empty"));
+    root->appendChild("outer")->appendChild("inner")->appendTextChild("text", QString("x"));
+    QDomElement domOuter = domDoc.createElement("outer");
+    QDomElement domInner = domDoc.createElement("inner");
+    QDomElement domInnerText = domDoc.createElement("text");
+    domInnerText.appendChild(domDoc.createTextNode("x"));
+    domInner.appendChild(domInnerText);
+    domOuter.appendChild(domInner);
+    domRoot.appendChild(domOuter);
+
+    XmlDomDocument doc(*root);
+    EXPECT_EQ(domDoc.toByteArray(1), doc.toByteArray());
+}
+
+TEST_F(XmlDomElementTest, testRoundTrip)
+{
+    XmlDomElement* root = new XmlDomElement("root");
+    foreach (const QString& value, getSpecialStrings()) {
+        XmlDomElement* child = root->appendTextChild("text", value);
+        child->setAttribute("value", value);
+    }
+    QByteArray data = XmlDomDocument(*root).toByteArray();
+
+    XmlDomDocument doc(data, FilePath());
+    XmlDomElement* child = doc.getRoot().getFirstChild("text", true);
+    foreach (const QString& value, getSpecialStrings()) {
+        ASSERT_NE(nullptr, child);
+        EXPECT_EQ(value, child->getText<QString>(false));
+        EXPECT_EQ(value, child->getAttribute<QString>("value", false));
+        child = child->getNextSibling("text", false);
+    }
+    EXPECT_EQ(nullptr, child);
+    EXPECT_EQ(data, doc.toByteArray());
+}
+
+TEST_F(XmlDomElementTest, testParse)
+{
+    QByteArray data("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                    "<root version=\"1\">\n"
+                    " <list>\n"
+                    "  <item id=\"1\">first</item>\n"
+                    "  <other/>\n"
+                    "  <item id=\"2\">  second  </item>\n"
+                    " </list>\n"
+                    " <empty>   </empty>\n"
+                    "</root>\n");
+    XmlDomDocument doc(data, FilePath());
+    XmlDomElement& root = doc.getRoot();
+    EXPECT_EQ(QString("root"), root.getName());
+    EXPECT_EQ(2, root.getChildCount());
+    XmlDomElement* list = root.getFirstChild("list", true);
+    EXPECT_EQ(3, list->getChildCount());
+    XmlDomElement* item = list->getFirstChild("item", true);
+    EXPECT_EQ(QString("1"), item->getAttribute<QString>("id", true));
+    EXPECT_EQ(QString("first"), item->getText<QString>(true));
+    item = item->getNextSibling("item", true);
+    EXPECT_EQ(QString("  second  "), item->getText<QString>(true));
+    EXPECT_EQ(nullptr, item->getNextSibling("item", false));
+    EXPECT_EQ(item, root.getFirstChild("list/item", true, true)->getNextSibling("item", false));
+    // whitespace-only texts are ignored
+    EXPECT_FALSE(root.getFirstChild("empty", true)->hasChilds());
+    EXPECT_EQ(QString(), root.getFirstChild("empty", true)->getText<QString>(false));
+}
+
+TEST_F(XmlDomElementTest, testParseError)
+{
+    EXPECT_THROW(XmlDomDocument("<root><a></root>", FilePath()), Exception);
+    EXPECT_THROW(XmlDomDocument("", FilePath()), Exception);
+}
+
+TEST_F(XmlDomElementTest, testAppendAndRemoveChilds)
+{
+    XmlDomElement root("root");
+    XmlDomElement* a1 = root.appendChild("a");
+    XmlDomElement* b1 = root.appendChild("b");
+    XmlDomElement* a2 = root.appendChild("a");
+    XmlDomElement* a3 = root.appendChild("a");
+    EXPECT_EQ(4, root.getChildCount());
+    EXPECT_EQ(a1, root.getFirstChild(false));
+    EXPECT_EQ(b1, root.getFirstChild("b", false));
+    EXPECT_EQ(a2, a1->getNextSibling("a", false));
+    EXPECT_EQ(b1, a1->getNextSibling(QString(), false));
+    EXPECT_EQ(a1, a2->getPreviousSibling("a", false));
+
+    // remove first child of a name
+    root.removeChild(a1, true);
+    EXPECT_EQ(3, root.getChildCount());
+    EXPECT_EQ(b1, root.getFirstChild(false));
+    EXPECT_EQ(a2, root.getFirstChild("a", false));
+    EXPECT_EQ(nullptr, a2->getPreviousSibling("a", false));
+
+    // remove child in the middle
+    root.removeChild(a2, false);
+    EXPECT_EQ(2, root.getChildCount());
+    EXPECT_EQ(a3, root.getFirstChild("a", false));
+    EXPECT_EQ(a3, b1->getNextSibling(QString(), false));
+    EXPECT_EQ(nullptr, a2->getParent());
+
+    // append the removed child again (it must be the last one now)
+    root.appendChild(a2);
+    EXPECT_EQ(a2, a3->getNextSibling("a", false));
+    EXPECT_EQ(nullptr, a2->getNextSibling(QString(), false));
+
+    // remove the last childs
+    delete a2; // removes itself from the parent
+    root.removeChild(a3, true);
+    EXPECT_EQ(1, root.getChildCount());
+    EXPECT_EQ(nullptr, root.getFirstChild("a", false));
+    EXPECT_EQ(nullptr, b1->getNextSibling(QString(), false));
+    root.removeChild(b1, true);
+    EXPECT_FALSE(root.hasChilds());
+    EXPECT_EQ(nullptr, root.getFirstChild(false));
+}
+
+TEST_F(XmlDomElementTest, testRenameChild)
+{
+    XmlDomElement root("root");
+    XmlDomElement* a = root.appendChild("a");
+    XmlDomElement* b = root.appendChild("b");
+    a->setName("b");
+    EXPECT_EQ(a, root.getFirstChild("b", false));
+    EXPECT_EQ(b, a->getNextSibling("b", false));
+    EXPECT_EQ(nullptr, root.getFirstChild("a", false));
+}
+
+TEST_F(XmlDomElementTest, testAttributesAreSorted)
+{
+    XmlDomElement root("root");
+    root.setAttribute("c", QString("3"));
+    root.setAttribute("a", QString("1"));
+    root.setAttribute("b", QString("2"));
+    root.setAttribute("a", QString("4")); // overwrite
+    EXPECT_TRUE(root.hasAttribute("b"));
+    EXPECT_FALSE(root.hasAttribute("d"));
+    EXPECT_EQ(QString("4"), root.getAttribute<QString>("a", true));
+
+    QByteArray output;
+    root.writeToByteArray(output, 1);
+    EXPECT_EQ(QByteArray("<root a=\"4\" b=\"2\" c=\"3\"/>\n"), output);
+
+    // attributes of parsed files must be sorted too
+    XmlDomDocument doc("<root z=\"1\" y=\"2\" x=\"3\"/>", FilePath());
+    EXPECT_EQ(QString("2"), doc.getRoot().getAttribute<QString>("y", true));
+    output.clear();
+    doc.getRoot().writeToByteArray(output, 1);
+    EXPECT_EQ(QByteArray("<root x=\"3\" y=\"2\" z=\"1\"/>\n"), output);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
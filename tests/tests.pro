@@ -13,7 +13,7 @@ GENERATED_DIR = ../generated
 # Use common project definitions
 include(../common.pri)
 
-QT += core
+QT += core xml
 QT -= gui widgets
 
 CONFIG += console
@@ -40,8 +40,14 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcbcommon.a
 
 SOURCES += main.cpp \
+    common/attributetexttemplatetest.cpp \
+    common/batchedchangestest.cpp \
+    common/disjointsettest.cpp \
     common/filepathtest.cpp \
     common/pointtest.cpp \
-    common/scopeguardtest.cpp
+    common/scopeguardtest.cpp \
+    common/undostacktest.cpp \
+    common/uuidtest.cpp \
+    common/xmldomelementtest.cpp
 
 HEADERS +=